@@ -0,0 +1,400 @@
+/*
+This module is the computer opponent. A fixed number of
+search threads take jobs from one queue. Each job is a
+position and a time budget: the thread deepens a negamax
+search one move at a time, keeps the best move of the
+deepest search it finished, and writes the job's eventfd
+so the event loop hosting the game picks the move up.
+On large boards only cells near marks already on the
+board are searched, best looking cells first. The 3 x 3
+game is not searched at all: its moves are looked up in
+the table gentable solved ahead of time.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+#include "ai.h"
+#include "perfect.h"
+#include "perfect-table.h"
+
+#define MAX_CELLS (MAX_SIDE * MAX_SIDE)
+#define TABLE_BITS 18       // Each thread remembers 2^18 positions
+#define WIN 1000000         // Score of winning with the move just made
+#define WON (WIN - MAX_CELLS - 1) // Scores past this are forced results
+#define NEAR 2              // Cells searched are this close to a mark
+#define CHECK_NODES 1024    // Positions searched between clock checks
+
+enum BOUND {
+   EXACT,               // Score is the position's value
+   LOWER,               // Position is worth at least the score
+   UPPER                // Position is worth at most the score
+};
+
+typedef struct TABLEENTRY {
+   uint64_t key;        // Hash of the position
+   int score;
+   short depth;         // Moves ahead the score was searched
+   short move;          // Best move found, -1 if none
+   char bound;
+}  TableEntry;
+
+typedef struct SEARCHER {
+   SearchJob *job;
+   TableEntry *table;   // Positions this thread has searched
+   uint64_t hash;       // Hash of the position being searched
+   long deadline;       // Monotonic nanoseconds the search stops by
+   long nodes;          // Positions searched so far
+   int aborted;         // 1 once the deadline has passed
+   int rootMove;        // Best move at the root of the current search
+}  Searcher;
+
+// Random key for each symbol on each cell, XORed into a position's hash
+uint64_t ZOBRIST[2][MAX_CELLS];
+
+void *searchThread(void *ptr);
+void chooseMove(Searcher *searcher);
+int negamax(Searcher *searcher, char side, int depth, int alpha, int beta,
+            int ply);
+int listMoves(Board *board, short *moves, int first);
+int scoreCell(Board *board, int cell);
+int runThrough(Board *board, int i, int j, int di, int dj, char symbol);
+int evaluate(Board *board, char side);
+int toTable(int score, int ply);
+int fromTable(int score, int ply);
+uint64_t nextRandom(uint64_t *state);
+long nowNs(void);
+
+/* Function creates the search threads and the keys positions
+   are hashed with.
+*/
+SearchPool *createSearchPool(int size) {
+   SearchPool *pool = (SearchPool*)calloc(1, sizeof(SearchPool));
+   uint64_t state = 0x9E3779B97F4A7C15ULL;
+   int i;
+
+   for(i = 0; i < MAX_CELLS; i++) {
+      ZOBRIST[0][i] = nextRandom(&state);
+      ZOBRIST[1][i] = nextRandom(&state);
+   }
+   pthread_mutex_init(&pool->lock, NULL);
+   pthread_cond_init(&pool->ready, NULL);
+   pool->size = size;
+   pool->threads = (pthread_t*)malloc(sizeof(pthread_t) * size);
+   for(i = 0; i < size; i++) {
+      pthread_create(&pool->threads[i], NULL, searchThread, pool);
+   }
+   return pool;
+}
+
+/* Function queues a job for the next free search thread.
+*/
+void submitSearch(SearchPool *pool, SearchJob *job) {
+   job->next = NULL;
+   pthread_mutex_lock(&pool->lock);
+   if(pool->tail == NULL) { pool->head = job; }
+   else { pool->tail->next = job; }
+   pool->tail = job;
+   pthread_cond_signal(&pool->ready);
+   pthread_mutex_unlock(&pool->lock);
+}
+
+/* Thread function takes search jobs off the queue one at a
+   time. The job belongs to the game again as soon as its
+   eventfd is written.
+*/
+void *searchThread(void *ptr) {
+   SearchPool *pool = (SearchPool*) ptr;
+   Searcher searcher;
+   SearchJob *job;
+   uint64_t one = 1;
+
+   searcher.table = (TableEntry*)malloc(sizeof(TableEntry) << TABLE_BITS);
+   while(1) {
+      pthread_mutex_lock(&pool->lock);
+      while(pool->head == NULL) {
+         pthread_cond_wait(&pool->ready, &pool->lock);
+      }
+      job = pool->head;
+      pool->head = job->next;
+      if(pool->head == NULL) { pool->tail = NULL; }
+      pthread_mutex_unlock(&pool->lock);
+
+      searcher.job = job;
+      chooseMove(&searcher);
+      write(job->wakefd, &one, sizeof(one));
+   }
+   return NULL;
+}
+
+/* Function searches one move deeper at a time until the
+   depth or time budget is used up, and sets the job's move
+   to the best move of the deepest search that finished.
+*/
+void chooseMove(Searcher *searcher) {
+   SearchJob *job = searcher->job;
+   Board *board = &job->board;
+   short moves[MAX_CELLS];
+   int cells = board->size * board->size;
+   int best, depth, score, cell;
+   unsigned char entry;
+
+   // Search deep enough to be perfect on the standard board is looked up
+   if(board->size == 3 && board->run == 3
+      && job->depth >= cells - board->moves) {
+      entry = PERFECT[boardIndex(board)];
+      if(entry != PERFECT_NONE && PERFECT_CELL(entry) != PERFECT_END) {
+         job->moveX = PERFECT_CELL(entry) / 3;
+         job->moveY = PERFECT_CELL(entry) % 3;
+         return;
+      }
+   }
+   memset(searcher->table, 0, sizeof(TableEntry) << TABLE_BITS);
+   searcher->hash = 0;
+   for(cell = 0; cell < cells; cell++) {
+      char symbol = getSymbol(board, cell / board->size, cell % board->size);
+      if(symbol == PLAYER1) { searcher->hash ^= ZOBRIST[0][cell]; }
+      else if(symbol == PLAYER2) { searcher->hash ^= ZOBRIST[1][cell]; }
+   }
+   searcher->deadline = nowNs() + job->budgetMs * 1000000L;
+   searcher->nodes = 0;
+   searcher->aborted = 0;
+
+   // Best looking cell is played if not even one move ahead is searched
+   listMoves(board, moves, -1);
+   best = moves[0];
+   for(depth = 1; depth <= job->depth; depth++) {
+      searcher->rootMove = -1;
+      score = negamax(searcher, job->symbol, depth, -WIN - 1, WIN + 1, 0);
+      // Time ran out, the unfinished search cannot be trusted
+      if(searcher->aborted) { break; }
+      if(searcher->rootMove != -1) { best = searcher->rootMove; }
+      // Win or loss is forced, searching deeper changes nothing
+      if(score > WON || score < -WON) { break; }
+      // Search already reached the end of every game
+      if(depth >= cells - board->moves) { break; }
+   }
+   job->moveX = best / board->size;
+   job->moveY = best % board->size;
+}
+
+/* Function gives the value of the position for side, the
+   player about to move, searching depth moves ahead. Scores
+   outside alpha and beta are not worth finding exactly.
+*/
+int negamax(Searcher *searcher, char side, int depth, int alpha, int beta,
+            int ply) {
+   Board *board = &searcher->job->board;
+   TableEntry *entry = &searcher->table[searcher->hash
+                                        & ((1 << TABLE_BITS) - 1)];
+   char other = side == PLAYER1 ? PLAYER2 : PLAYER1;
+   int sideKey = side == PLAYER1 ? 0 : 1;
+   int alphaIn = alpha, best = -WIN - 1, bestMove = -1;
+   short moves[MAX_CELLS];
+   int count, i, x, y, last, score;
+
+   // Look at the clock every so many positions
+   if(++searcher->nodes % CHECK_NODES == 0 && nowNs() > searcher->deadline) {
+      searcher->aborted = 1;
+   }
+   if(searcher->aborted) { return 0; }
+   // Position was already searched at least this deep
+   if(ply > 0 && entry->key == searcher->hash && entry->depth >= depth) {
+      score = fromTable(entry->score, ply);
+      if(entry->bound == EXACT) { return score; }
+      if(entry->bound == LOWER && score >= beta) { return score; }
+      if(entry->bound == UPPER && score <= alpha) { return score; }
+   }
+   if(depth == 0) { return evaluate(board, side); }
+
+   count = listMoves(board, moves,
+                     entry->key == searcher->hash ? entry->move : -1);
+   for(i = 0; i < count && alpha < beta; i++) {
+      x = moves[i] / board->size;
+      y = moves[i] % board->size;
+      last = board->last;
+      markBoard(board, x, y, side);
+      searcher->hash ^= ZOBRIST[sideKey][moves[i]];
+      // Sooner wins score higher
+      if(checkWin(board, side) == 1) { score = WIN - ply; }
+      else if(checkDraw(board) == 2) { score = 0; }
+      else { score = -negamax(searcher, other, depth - 1, -beta, -alpha, ply + 1); }
+      searcher->hash ^= ZOBRIST[sideKey][moves[i]];
+      unmarkBoard(board, x, y, side, last);
+      if(searcher->aborted) { return 0; }
+
+      if(score > best) {
+         best = score;
+         bestMove = moves[i];
+         if(ply == 0) { searcher->rootMove = bestMove; }
+      }
+      if(score > alpha) { alpha = score; }
+   }
+   // No cell was free, which checkDraw already ends the game for
+   if(count == 0) { return 0; }
+
+   entry->key = searcher->hash;
+   entry->score = toTable(best, ply);
+   entry->depth = depth;
+   entry->move = bestMove;
+   entry->bound = best <= alphaIn ? UPPER : best >= beta ? LOWER : EXACT;
+   return best;
+}
+
+/* Function lists the free cells worth searching, with first
+   (the best move found before, or -1) ahead of the rest and
+   the rest best looking first. Returns how many were listed.
+*/
+int listMoves(Board *board, short *moves, int first) {
+   char near[MAX_CELLS];
+   int scores[MAX_CELLS];
+   int size = board->size, cells = size * size;
+   int count = 0, cell, i, j, di, dj, score;
+
+   // Large empty board, nothing beats the center
+   if(board->moves == 0 && size > 2 * NEAR + 1) {
+      moves[0] = (size / 2) * size + size / 2;
+      return 1;
+   }
+   // Small boards search every cell, large ones cells near marks
+   memset(near, size <= 2 * NEAR + 1, cells);
+   for(cell = 0; cell < cells && size > 2 * NEAR + 1; cell++) {
+      i = cell / size;
+      j = cell % size;
+      if(isTaken(board, i, j) == 1) { continue; }
+      for(di = -NEAR; di <= NEAR; di++) {
+         for(dj = -NEAR; dj <= NEAR; dj++) {
+            if(onBoard(board, i + di, j + dj)) { near[(i + di) * size + j + dj] = 1; }
+         }
+      }
+   }
+   for(cell = 0; cell < cells; cell++) {
+      if(!near[cell] || isTaken(board, cell / size, cell % size) == 0) {
+         continue;
+      }
+      score = cell == first ? INT_MAX : scoreCell(board, cell);
+      // Insert in order of score, best first
+      for(i = count; i > 0 && scores[i - 1] < score; i--) {
+         moves[i] = moves[i - 1];
+         scores[i] = scores[i - 1];
+      }
+      moves[i] = cell;
+      scores[i] = score;
+      count++;
+   }
+   return count;
+}
+
+/* Function scores a free cell by the runs of either player's
+   marks it would extend or block, longer runs counting far
+   more than shorter ones.
+*/
+int scoreCell(Board *board, int cell) {
+   static const int STEPS[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+   int i = cell / board->size, j = cell % board->size;
+   int score = 0, d, run;
+
+   for(d = 0; d < 4; d++) {
+      run = runThrough(board, i, j, STEPS[d][0], STEPS[d][1], PLAYER1);
+      score += 1 << (3 * (run < 8 ? run : 8));
+      run = runThrough(board, i, j, STEPS[d][0], STEPS[d][1], PLAYER2);
+      score += 1 << (3 * (run < 8 ? run : 8));
+   }
+   return score;
+}
+
+/* Function counts symbol's marks in a row on both sides of
+   cell (i, j) along the step (di, dj).
+*/
+int runThrough(Board *board, int i, int j, int di, int dj, char symbol) {
+   int count = 0, step, x, y;
+
+   for(step = -1; step <= 1; step += 2) {
+      x = i + step * di;
+      y = j + step * dj;
+      while(onBoard(board, x, y) && getSymbol(board, x, y) == symbol) {
+         count++;
+         x += step * di;
+         y += step * dj;
+      }
+   }
+   return count;
+}
+
+/* Function scores a position for side without searching, by
+   the lines of run cells one player could still complete,
+   each worth more the more of it that player already holds.
+*/
+int evaluate(Board *board, char side) {
+   static const int STEPS[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+   long long total = 0;
+   int i, j, d, t, xs, os;
+   char symbol;
+
+   for(i = 0; i < board->size; i++) {
+      for(j = 0; j < board->size; j++) {
+         for(d = 0; d < 4; d++) {
+            // Line would run off the board
+            if(!onBoard(board, i + (board->run - 1) * STEPS[d][0],
+                        j + (board->run - 1) * STEPS[d][1])) {
+               continue;
+            }
+            xs = os = 0;
+            for(t = 0; t < board->run; t++) {
+               symbol = getSymbol(board, i + t * STEPS[d][0],
+                                  j + t * STEPS[d][1]);
+               if(symbol == PLAYER1) { xs++; }
+               else if(symbol == PLAYER2) { os++; }
+            }
+            // Only a line held by one player can still be completed
+            if(xs > 0 && os == 0) { total += 1LL << (2 * (xs < 8 ? xs : 8)); }
+            else if(os > 0 && xs == 0) { total -= 1LL << (2 * (os < 8 ? os : 8)); }
+         }
+      }
+   }
+   if(side == PLAYER2) { total = -total; }
+   // Keep below any forced result
+   if(total > WON / 2) { total = WON / 2; }
+   if(total < -WON / 2) { total = -WON / 2; }
+   return (int) total;
+}
+
+/* Function stores a forced result as moves from the stored
+   position instead of from the root of the search.
+*/
+int toTable(int score, int ply) {
+   if(score > WON) { return score + ply; }
+   if(score < -WON) { return score - ply; }
+   return score;
+}
+
+/* Function turns a stored forced result back into moves
+   from the root of the search.
+*/
+int fromTable(int score, int ply) {
+   if(score > WON) { return score - ply; }
+   if(score < -WON) { return score + ply; }
+   return score;
+}
+
+/* Function gives the next number of a splitmix64 sequence.
+*/
+uint64_t nextRandom(uint64_t *state) {
+   uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+   z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+   return z ^ (z >> 31);
+}
+
+/* Function gets the time on the monotonic clock in
+   nanoseconds.
+*/
+long nowNs(void) {
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return now.tv_sec * 1000000000L + now.tv_nsec;
+}
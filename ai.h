@@ -0,0 +1,41 @@
+/*
+This module is the computer opponent. Moves are chosen by
+a negamax search with alpha-beta pruning and a table of
+positions already searched, deepening one move at a time
+until the time budget runs out. Searches run on their own
+threads so they never hold up an event loop.
+*/
+
+#ifndef AI_H
+#define AI_H
+
+#include <pthread.h>
+#include "board.h"
+
+typedef struct SEARCHJOB SearchJob;
+
+struct SEARCHJOB {
+   Board board;         // Position the computer moves from
+   char symbol;         // Symbol the computer plays
+   int depth;           // Most moves ahead that are searched
+   int budgetMs;        // Time the search may take
+   int moveX;           // Move chosen by the search
+   int moveY;
+   int wakefd;          // eventfd written once the move is chosen
+   void *owner;         // Game the move is for
+   SearchJob *next;
+};
+
+typedef struct SEARCHPOOL {
+   pthread_t *threads;
+   int size;
+   pthread_mutex_t lock;
+   pthread_cond_t ready; // Signaled when a job is queued
+   SearchJob *head;     // Jobs waiting for a thread
+   SearchJob *tail;
+}  SearchPool;
+
+SearchPool *createSearchPool(int size);
+void submitSearch(SearchPool *pool, SearchJob *job);
+
+#endif
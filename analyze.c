@@ -0,0 +1,606 @@
+/*
+Compile: gcc -O2 -o analyze analyze.c journal.c board.c wire.c -lpthread
+Run:     ./analyze [-t threads] [journal directory]
+
+This program reads the journal of games the server
+keeps, on as many threads as there are CPUs unless told
+otherwise (-t), each taking whole segments in turn. Every
+game is played again with the board functions the server
+plays with, so its result is found the way the server
+found it, and the program reports how often each opening
+is played, how often the first player wins on each board,
+each player's record, and on the 3 x 3 board how many
+moves threw away a win or a draw against perfect play.
+Openings and positions are counted once for all 8 ways
+the board can be turned or flipped, so the tables only
+hold positions that really differ. Players are named
+from the scoreboard in the current directory, if any.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "board.h"
+#include "journal.h"
+#include "storage.h"
+#include "perfect.h"
+#include "perfect-table.h"
+
+#define POSITIONS 19683  // 3 to the 9th
+#define OPENING_PLIES 3  // Moves that make an opening
+#define TOP 10           // Rows printed of each table
+#define SYMMETRIES 8     // Ways to turn or flip a square board
+
+typedef struct RESULTS {
+   long games;
+   long xWins;
+   long oWins;
+   long draws;
+}  Results;
+
+typedef struct OPENING {
+   unsigned long key;   // Board size, moves, then their cells, 0 if unused
+   Results results;
+}  Opening;
+
+typedef struct PLAYERSTATS {
+   long games;
+   long wins;
+   long losses;
+   long draws;
+   long moves;
+   long blunders;       // Moves that threw away a win or a draw
+}  PlayerStats;
+
+typedef struct TALLY {
+   long games;
+   long abandoned;
+   long mismatched;     // Games whose moves do not lead to their result
+   long moves;
+   long checked;        // Moves checked against perfect play
+   long blunders;
+   Results boards[MAX_SIDE + 1][MAX_SIDE + 1]; // By size and run
+   Opening *openings;   // Open addressing table by key
+   int openingCap;      // Always a power of two
+   int openingCount;
+   PlayerStats *players; // By location on scoreboard
+   int playerCap;
+   long blunderAt[POSITIONS]; // Blunders made from each canonical position
+}  Tally;
+
+typedef struct SCAN {
+   char *dir;
+   atomic_int next;     // Next segment to be taken
+   int last;            // Last segment of the journal
+   Tally *tallies;      // One per thread
+}  Scan;
+
+typedef struct SCANNER {
+   Scan *scan;
+   Tally *tally;
+}  Scanner;
+
+int POW3[9];
+
+void *scanSegments(void *arg);
+void tallyGame(Tally *tally, JournalGame *game);
+int transformCell(int cell, int size, int symmetry);
+unsigned long openingKey(JournalGame *game);
+int canonicalIndex(int index);
+Results *findOpening(Tally *tally, unsigned long key);
+PlayerStats *playerStats(Tally *tally, int loc);
+void countResult(Results *results, int result);
+void mergeTally(Tally *into, Tally *from);
+void printReport(Tally *tally, char *names, int stride, int named);
+int compareOpenings(const void *a, const void *b);
+void printResults(Results *results);
+char *mapNames(int *stride, int *count);
+double clockSeconds(void);
+
+/* Main function which scans the journal on every thread,
+   adds up what each counted, and prints the report.
+*/
+int main(int argc, char *argv[]) {
+   int threads = sysconf(_SC_NPROCESSORS_ONLN);
+   int option, first, last, i, stride, named;
+   pthread_t *ids;
+   Scanner *scanners;
+   Scan scan;
+   char *names;
+   double started, took;
+
+   // Read thread count option
+   while((option = getopt(argc, argv, "t:")) != -1) {
+      if(option == 't' && (threads = atoi(optarg)) < 1) {
+         printf("Analysis needs at least one thread\n");
+         exit(1);
+      }
+      else if(option == '?') { exit(1); }
+   }
+   scan.dir = optind < argc ? argv[optind] : JOURNAL_DIR;
+   // Journal has no segments
+   if(findSegments(scan.dir, &first, &last) == 0) {
+      printf("No journal in %s\n", scan.dir);
+      exit(1);
+   }
+   POW3[0] = 1;
+   for(i = 1; i < 9; i++) { POW3[i] = POW3[i - 1] * 3; }
+   atomic_init(&scan.next, first);
+   scan.last = last;
+   scan.tallies = (Tally*)calloc(threads, sizeof(Tally));
+   scanners = (Scanner*)malloc(sizeof(Scanner) * threads);
+   ids = (pthread_t*)malloc(sizeof(pthread_t) * threads);
+
+   started = clockSeconds();
+   for(i = 0; i < threads; i++) {
+      scanners[i].scan = &scan;
+      scanners[i].tally = &scan.tallies[i];
+      pthread_create(&ids[i], NULL, scanSegments, &scanners[i]);
+   }
+   for(i = 0; i < threads; i++) {
+      pthread_join(ids[i], NULL);
+      if(i > 0) { mergeTally(&scan.tallies[0], &scan.tallies[i]); }
+   }
+   took = clockSeconds() - started;
+
+   printf("%ld games, %ld moves, %ld abandoned, %ld not ending as recorded\n",
+          scan.tallies[0].games, scan.tallies[0].moves,
+          scan.tallies[0].abandoned, scan.tallies[0].mismatched);
+   printf("Read in %.3f s on %d threads, %.0f games/s\n\n", took, threads,
+          took > 0 ? (scan.tallies[0].games + scan.tallies[0].abandoned
+                      + scan.tallies[0].mismatched) / took : 0.0);
+   names = mapNames(&stride, &named);
+   printReport(&scan.tallies[0], names, stride, named);
+}
+
+/* Thread function takes segments in turn until none are
+   left and counts every game in them.
+*/
+void *scanSegments(void *arg) {
+   Scanner *scanner = (Scanner*) arg;
+   JournalReader *reader;
+   JournalGame *game;
+   int segment;
+
+   while((segment = atomic_fetch_add(&scanner->scan->next, 1))
+         <= scanner->scan->last) {
+      reader = openReader(scanner->scan->dir, segment, segment);
+      while((game = nextGame(reader)) != NULL) {
+         tallyGame(scanner->tally, game);
+      }
+      closeReader(reader);
+   }
+   return NULL;
+}
+
+/* Function plays a game again and counts it. On the 3 x 3
+   board each move is checked against the perfect play
+   table, from the base 3 index of the board kept as moves
+   are made the way boardIndex counts it. Nothing is counted
+   until the whole game was played again, so a game whose
+   players are impossible or whose moves do not lead to its
+   result is counted as such and no more.
+*/
+void tallyGame(Tally *tally, JournalGame *game) {
+   PlayerStats *x, *o;
+   Board board;
+   char turn = PLAYER1;
+   int perfect = game->size == 3 && game->run == 3;
+   int ply, cell, index = 0, before, after, result = ABANDONED;
+   int moves[2] = {0, 0}, blunders[2] = {0, 0}, blunderAt[9], found = 0, i;
+
+   // Abandoned games have no result to count
+   if(game->result == ABANDONED) {
+      tally->abandoned++;
+      return;
+   }
+   // Players are not on any scoreboard
+   if(game->playerX < 0 || game->playerO < 0) {
+      tally->mismatched++;
+      return;
+   }
+   initBoard(&board, game->size, game->run);
+   for(ply = 0; ply < game->plies; ply++) {
+      cell = gameCell(game, ply);
+      // Move is off the board, on a taken cell, or after the game was over
+      if(cell >= board.size * board.size || result != ABANDONED
+         || !isTaken(&board, cell / board.size, cell % board.size)) {
+         tally->mismatched++;
+         return;
+      }
+      markBoard(&board, cell / board.size, cell % board.size, turn);
+      moves[turn == PLAYER1 ? 0 : 1]++;
+      if(perfect) {
+         before = PERFECT[index];
+         index += (turn == PLAYER1 ? 1 : 2) * POW3[cell];
+         after = PERFECT[index];
+         // Move leaves the mover worse off than the best move would
+         if(PERFECT_WIN - PERFECT_VALUE(after) < PERFECT_VALUE(before)) {
+            blunders[turn == PLAYER1 ? 0 : 1]++;
+            blunderAt[found++] = canonicalIndex(index
+                                                - (turn == PLAYER1 ? 1 : 2)
+                                                  * POW3[cell]);
+         }
+      }
+      // If this move won or drew the game
+      if(checkWin(&board, turn) == 1) {
+         result = turn == PLAYER1 ? X_WON : O_WON;
+      }
+      else if(checkDraw(&board) == 2) { result = DRAWN; }
+      turn = turn == PLAYER1 ? PLAYER2 : PLAYER1;
+   }
+   // Moves stop before the game is over or lead to another result
+   if(result != game->result) {
+      tally->mismatched++;
+      return;
+   }
+   x = playerStats(tally, game->playerX);
+   o = playerStats(tally, game->playerO);
+   x->moves += moves[0];
+   o->moves += moves[1];
+   if(perfect) {
+      tally->checked += game->plies;
+      tally->blunders += found;
+      x->blunders += blunders[0];
+      o->blunders += blunders[1];
+      for(i = 0; i < found; i++) { tally->blunderAt[blunderAt[i]]++; }
+   }
+   tally->games++;
+   tally->moves += game->plies;
+   countResult(&tally->boards[game->size][game->run], result);
+   countResult(findOpening(tally, openingKey(game)), result);
+   x->games++;
+   o->games++;
+   if(result == X_WON) {
+      x->wins++;
+      o->losses++;
+   }
+   else if(result == O_WON) {
+      o->wins++;
+      x->losses++;
+   }
+   else {
+      x->draws++;
+      o->draws++;
+   }
+}
+
+/* Function gives where a cell goes when a square board is
+   turned or flipped. Symmetries 0 to 3 turn the board a
+   quarter at a time, and 4 to 7 flip it and then turn it.
+*/
+int transformCell(int cell, int size, int symmetry) {
+   int i = cell / size, j = cell % size, last = size - 1, turned;
+
+   // Flip across the middle column first
+   if(symmetry >= 4) { j = last - j; }
+   for(turned = 0; turned < symmetry % 4; turned++) {
+      int k = i;
+      i = j;
+      j = last - k;
+   }
+   return i * size + j;
+}
+
+/* Function packs a game's first moves into one key: the
+   board size, the number of moves, then each move's cell,
+   taking whichever turn or flip of them gives the smallest
+   key, so every turn or flip of an opening has one key.
+   Each move takes 9 bits whether it was made or not.
+*/
+unsigned long openingKey(JournalGame *game) {
+   int plies = game->plies < OPENING_PLIES ? game->plies : OPENING_PLIES;
+   unsigned long key, best = 0;
+   int symmetry, ply;
+
+   for(symmetry = 0; symmetry < SYMMETRIES; symmetry++) {
+      key = (unsigned long) game->size << 8 | plies;
+      for(ply = 0; ply < plies; ply++) {
+         key = key << 9 | transformCell(gameCell(game, ply), game->size,
+                                        symmetry);
+      }
+      // Leave the same room for every move so keys can be read back
+      key <<= 9 * (OPENING_PLIES - plies);
+      if(symmetry == 0 || key < best) { best = key; }
+   }
+   return best;
+}
+
+/* Function gives the smallest base 3 index of any turn or
+   flip of the 3 x 3 position at a base 3 index.
+*/
+int canonicalIndex(int index) {
+   int best = index, symmetry, cell, turned;
+
+   for(symmetry = 1; symmetry < SYMMETRIES; symmetry++) {
+      turned = 0;
+      for(cell = 0; cell < 9; cell++) {
+         turned += index / POW3[cell] % 3 * POW3[transformCell(cell, 3,
+                                                               symmetry)];
+      }
+      if(turned < best) { best = turned; }
+   }
+   return best;
+}
+
+/* Function finds the results of an opening, adding the
+   opening to the table the first time it is seen. The
+   table doubles once it is half full.
+*/
+Results *findOpening(Tally *tally, unsigned long key) {
+   Opening *old = tally->openings;
+   int oldCap = tally->openingCap, i;
+   unsigned int slot;
+
+   // Keep the table at most half full
+   if(tally->openingCount * 2 >= tally->openingCap) {
+      tally->openingCap = oldCap == 0 ? 1024 : oldCap * 2;
+      tally->openings = (Opening*)calloc(tally->openingCap, sizeof(Opening));
+      tally->openingCount = 0;
+      for(i = 0; i < oldCap; i++) {
+         if(old[i].key == 0) { continue; }
+         *findOpening(tally, old[i].key) = old[i].results;
+      }
+      free(old);
+   }
+   slot = (key * 0x9E3779B97F4A7C15UL >> 40) & (tally->openingCap - 1);
+   while(tally->openings[slot].key != 0 && tally->openings[slot].key != key) {
+      slot = (slot + 1) & (tally->openingCap - 1);
+   }
+   // Opening is seen for the first time
+   if(tally->openings[slot].key == 0) {
+      tally->openings[slot].key = key;
+      tally->openingCount++;
+   }
+   return &tally->openings[slot].results;
+}
+
+/* Function gets the stats of the player at a location,
+   growing the stats to cover them.
+*/
+PlayerStats *playerStats(Tally *tally, int loc) {
+   int cap;
+
+   if(loc >= tally->playerCap) {
+      cap = tally->playerCap == 0 ? 1024 : tally->playerCap;
+      while(loc >= cap) { cap *= 2; }
+      tally->players = (PlayerStats*)realloc(tally->players,
+                                             cap * sizeof(PlayerStats));
+      memset(tally->players + tally->playerCap, 0,
+             (cap - tally->playerCap) * sizeof(PlayerStats));
+      tally->playerCap = cap;
+   }
+   return &tally->players[loc];
+}
+
+/* Function counts one game's result.
+*/
+void countResult(Results *results, int result) {
+   results->games++;
+   if(result == X_WON) { results->xWins++; }
+   else if(result == O_WON) { results->oWins++; }
+   else { results->draws++; }
+}
+
+/* Function adds everything one thread counted to what
+   another counted.
+*/
+void mergeTally(Tally *into, Tally *from) {
+   Results *results;
+   PlayerStats *stats;
+   int i, j;
+
+   into->games += from->games;
+   into->abandoned += from->abandoned;
+   into->mismatched += from->mismatched;
+   into->moves += from->moves;
+   into->checked += from->checked;
+   into->blunders += from->blunders;
+   for(i = 0; i <= MAX_SIDE; i++) {
+      for(j = 0; j <= MAX_SIDE; j++) {
+         into->boards[i][j].games += from->boards[i][j].games;
+         into->boards[i][j].xWins += from->boards[i][j].xWins;
+         into->boards[i][j].oWins += from->boards[i][j].oWins;
+         into->boards[i][j].draws += from->boards[i][j].draws;
+      }
+   }
+   for(i = 0; i < from->openingCap; i++) {
+      if(from->openings[i].key == 0) { continue; }
+      results = findOpening(into, from->openings[i].key);
+      results->games += from->openings[i].results.games;
+      results->xWins += from->openings[i].results.xWins;
+      results->oWins += from->openings[i].results.oWins;
+      results->draws += from->openings[i].results.draws;
+   }
+   for(i = 0; i < from->playerCap; i++) {
+      if(from->players[i].games == 0) { continue; }
+      stats = playerStats(into, i);
+      stats->games += from->players[i].games;
+      stats->wins += from->players[i].wins;
+      stats->losses += from->players[i].losses;
+      stats->draws += from->players[i].draws;
+      stats->moves += from->players[i].moves;
+      stats->blunders += from->players[i].blunders;
+   }
+   for(i = 0; i < POSITIONS; i++) { into->blunderAt[i] += from->blunderAt[i]; }
+   free(from->openings);
+   free(from->players);
+}
+
+/* Function prints the report: results on each board, the
+   most played openings, the players with the most games,
+   and on the 3 x 3 board the positions most often blundered
+   from. Players are shown by name when the scoreboard holds
+   them and by location otherwise.
+*/
+void printReport(Tally *tally, char *names, int stride, int named) {
+   Opening *openings;
+   PlayerStats *stats;
+   Board board;
+   int count = 0, size, run, i, j, ply, best, cell, symbol;
+   unsigned long key;
+   long most;
+
+   printf("Results by board\n");
+   for(size = 3; size <= MAX_SIDE; size++) {
+      for(run = 3; run <= size; run++) {
+         if(tally->boards[size][run].games == 0) { continue; }
+         printf("  %2d x %-2d run %-2d ", size, size, run);
+         printResults(&tally->boards[size][run]);
+      }
+   }
+
+   // Sort the used openings by how often they were played
+   openings = (Opening*)malloc(sizeof(Opening) * (tally->openingCount + 1));
+   for(i = 0; i < tally->openingCap; i++) {
+      if(tally->openings[i].key == 0) { continue; }
+      openings[count++] = tally->openings[i];
+   }
+   qsort(openings, count, sizeof(Opening), compareOpenings);
+   printf("\nMost played openings of %d\n", count);
+   for(i = 0; i < count && i < TOP; i++) {
+      key = openings[i].key;
+      ply = key >> (9 * OPENING_PLIES) & 0xFF;
+      size = key >> (9 * OPENING_PLIES + 8);
+      printf("  %2d x %-2d", size, size);
+      for(j = 0; j < OPENING_PLIES; j++) {
+         // Opening has fewer moves than most
+         if(j >= ply) {
+            printf("      ");
+            continue;
+         }
+         cell = key >> (9 * (OPENING_PLIES - 1 - j)) & 0x1FF;
+         printf(" (%d,%d)", cell / size, cell % size);
+      }
+      printf("  ");
+      printResults(&openings[i].results);
+   }
+   free(openings);
+
+   printf("\nPlayers with the most games\n");
+   for(i = 0; i < TOP; i++) {
+      // Find the next player with the most games
+      best = -1;
+      most = 0;
+      for(j = 0; j < tally->playerCap; j++) {
+         if(tally->players[j].games > most) {
+            most = tally->players[j].games;
+            best = j;
+         }
+      }
+      if(best == -1) { break; }
+      stats = &tally->players[best];
+      if(best < named) { printf("  %-20.20s", names + (long) best * stride); }
+      else { printf("  player %-13d", best); }
+      printf(" %6ld games %6ld won %6ld lost %6ld drawn %6ld blunders\n",
+             stats->games, stats->wins, stats->losses, stats->draws,
+             stats->blunders);
+      // Leave the player out of the rest of the search
+      stats->games = -stats->games;
+   }
+   for(j = 0; j < tally->playerCap; j++) {
+      if(tally->players[j].games < 0) {
+         tally->players[j].games = -tally->players[j].games;
+      }
+   }
+
+   printf("\n%ld of %ld moves on the 3 x 3 board threw away a win or a draw\n",
+          tally->blunders, tally->checked);
+   for(i = 0; i < TOP; i++) {
+      // Find the next position blundered from most
+      best = -1;
+      most = 0;
+      for(j = 0; j < POSITIONS; j++) {
+         if(tally->blunderAt[j] > most) {
+            most = tally->blunderAt[j];
+            best = j;
+         }
+      }
+      if(best == -1) { break; }
+      printf("\nBlundered from %ld times\n", most);
+      initBoard(&board, 3, 3);
+      for(cell = 0; cell < 9; cell++) {
+         symbol = best / POW3[cell] % 3;
+         if(symbol != 0) {
+            markBoard(&board, cell / 3, cell % 3, symbol == 1 ? PLAYER1
+                                                               : PLAYER2);
+         }
+      }
+      printBoard(&board);
+      tally->blunderAt[best] = 0;
+   }
+}
+
+/* Function compares two openings so the most played sorts
+   first.
+*/
+int compareOpenings(const void *a, const void *b) {
+   long first = ((Opening*) a)->results.games;
+   long second = ((Opening*) b)->results.games;
+
+   return first < second ? 1 : first > second ? -1 : 0;
+}
+
+/* Function prints how many games there were and how often
+   each side won.
+*/
+void printResults(Results *results) {
+   double games = results->games;
+
+   printf("%8ld games  X %5.1f%%  O %5.1f%%  drawn %5.1f%%\n", results->games,
+          100 * results->xWins / games, 100 * results->oWins / games,
+          100 * results->draws / games);
+}
+
+/* Function maps the scoreboard snapshot to name players.
+   Each record starts with the player's name. Returns the
+   first record and sets the bytes between records and how
+   many there are, or NULL if there is no snapshot to read.
+*/
+char *mapNames(int *stride, int *count) {
+   SnapshotHeader *header;
+   struct stat info;
+   char *map;
+   int fd = open(SNAPSHOT_FILE, O_RDONLY);
+
+   *stride = 0;
+   *count = 0;
+   // Server has never run here
+   if(fd == -1) { return NULL; }
+   if(fstat(fd, &info) == -1 || info.st_size < (long) sizeof(SnapshotHeader)) {
+      close(fd);
+      return NULL;
+   }
+   map = (char*)mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if(map == MAP_FAILED) { return NULL; }
+   header = (SnapshotHeader*) map;
+   // Snapshot is not one this program knows how to read
+   if(memcmp(header->magic, SNAPSHOT_MAGIC, 8) != 0
+      || header->version > SNAPSHOT_VERSION
+      || header->headerSize < (int) sizeof(SnapshotHeader)
+      || header->stride < (int) sizeof(((PlayerRecord*) 0)->name)
+      || header->headerSize + (long) header->count * header->stride
+         > info.st_size) {
+      munmap(map, info.st_size);
+      return NULL;
+   }
+   *stride = header->stride;
+   *count = header->count;
+   return map + header->headerSize;
+}
+
+/* Function gets the time on the monotonic clock in seconds.
+*/
+double clockSeconds(void) {
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return now.tv_sec + now.tv_nsec / 1e9;
+}
@@ -0,0 +1,332 @@
+/*
+This module keeps the audience of every live game in a
+hash table chained by game id, which is only locked while
+spectators arrive and games open or close. Everything
+else about an audience happens on the worker hosting the
+game, so the counts on shared updates need no atomics.
+A spectator's updates are sent with one sendmsg from the
+shared buffers, never copied per spectator.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdint.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include "audience.h"
+
+void growAudiences(AudienceTable *table);
+void queueUpdate(Spectator *spectator, Update *update);
+void skipAhead(Spectator *spectator);
+void sendUpdates(Spectator *spectator);
+void watchSpectator(Connection *conn, int events);
+void dropSpectator(Spectator *spectator);
+void releaseUpdate(Update *update);
+
+/* Function creates an empty audience table.
+*/
+AudienceTable *createAudiences(void) {
+   AudienceTable *table = (AudienceTable*)calloc(1, sizeof(AudienceTable));
+
+   table->cap = 1024;
+   table->buckets = (Audience**)calloc(table->cap, sizeof(Audience*));
+   table->nextId = 1;
+   pthread_mutex_init(&table->lock, NULL);
+   return table;
+}
+
+/* Function opens the audience of a game under the next id.
+   Spectators who arrive are handed over through wakefd.
+*/
+Audience *openAudience(AudienceTable *table, int wakefd, int policy) {
+   Audience *audience = (Audience*)calloc(1, sizeof(Audience));
+   Audience **bucket;
+
+   audience->wakefd = wakefd;
+   audience->policy = policy;
+   pthread_mutex_lock(&table->lock);
+   audience->id = table->nextId++;
+   // Skip 0 once the ids wrap around
+   if(table->nextId <= 0) { table->nextId = 1; }
+   bucket = &table->buckets[audience->id & (table->cap - 1)];
+   audience->next = *bucket;
+   *bucket = audience;
+   table->count++;
+   // Keep chains about one audience long
+   if(table->count > table->cap) { growAudiences(table); }
+   pthread_mutex_unlock(&table->lock);
+   return audience;
+}
+
+/* Function finds the audience of a live game by id. Returns
+   NULL if no live game has that id. The caller holds the
+   table's lock.
+*/
+Audience *findAudience(AudienceTable *table, int id) {
+   Audience *audience = table->buckets[id & (table->cap - 1)];
+
+   while(audience != NULL && audience->id != id) {
+      audience = audience->next;
+   }
+   return audience;
+}
+
+/* Function leaves a detached connection waiting to watch
+   a game and wakes the game's worker to take it. The caller
+   holds the table's lock.
+*/
+void arriveSpectator(Audience *audience, Connection *conn) {
+   Spectator *spectator = (Spectator*)calloc(1, sizeof(Spectator));
+   uint64_t one = 1;
+
+   spectator->conn = conn;
+   spectator->next = audience->arriving;
+   audience->arriving = spectator;
+   write(audience->wakefd, &one, sizeof(one));
+}
+
+/* Function takes every spectator waiting to watch a game,
+   for the game's worker to attach and add.
+*/
+Spectator *takeArrivals(AudienceTable *table, Audience *audience) {
+   Spectator *arrivals;
+
+   pthread_mutex_lock(&table->lock);
+   arrivals = audience->arriving;
+   audience->arriving = NULL;
+   pthread_mutex_unlock(&table->lock);
+   return arrivals;
+}
+
+/* Function adds a spectator whose connection is attached to
+   the game's worker to the audience, and sends it the first
+   message, which tells it what it is watching. Spectators
+   are only listened to for leaving.
+*/
+void addSpectator(Audience *audience, Spectator *spectator, Message *first) {
+   Update *update = (Update*)malloc(sizeof(Update) + first->len);
+
+   update->refs = 1;
+   update->len = first->len;
+   memcpy(update->data, first->data, first->len);
+   spectator->audience = audience;
+   spectator->prev = NULL;
+   spectator->next = audience->watching;
+   if(audience->watching != NULL) { audience->watching->prev = spectator; }
+   audience->watching = spectator;
+   audience->count++;
+   spectator->conn->handler = watchSpectator;
+   spectator->conn->owner = spectator;
+   watchInput(spectator->conn, 1);
+   queueUpdate(spectator, update);
+   releaseUpdate(update);
+}
+
+/* Function builds one shared update from a message and
+   queues it for every spectator, each of whom sends as much
+   of it as its socket takes right away.
+*/
+void publishUpdate(Audience *audience, Message *msg) {
+   Spectator *spectator, *next;
+   Update *update;
+
+   // Nobody is watching, nothing to build
+   if(audience->watching == NULL) { return; }
+   update = (Update*)malloc(sizeof(Update) + msg->len);
+   update->refs = 1;
+   update->len = msg->len;
+   memcpy(update->data, msg->data, msg->len);
+   for(spectator = audience->watching; spectator != NULL; spectator = next) {
+      next = spectator->next;
+      queueUpdate(spectator, update);
+   }
+   releaseUpdate(update);
+}
+
+/* Function closes the audience of a game that is over.
+   Spectators still sending finish their updates and are
+   then closed. Returns the spectators who arrived too late,
+   for the caller to attach and turn away.
+*/
+Spectator *closeAudience(AudienceTable *table, Audience *audience) {
+   Audience **link;
+   Spectator *arrivals, *spectator, *next;
+
+   pthread_mutex_lock(&table->lock);
+   link = &table->buckets[audience->id & (table->cap - 1)];
+   while(*link != audience) { link = &(*link)->next; }
+   *link = audience->next;
+   table->count--;
+   arrivals = audience->arriving;
+   pthread_mutex_unlock(&table->lock);
+
+   for(spectator = audience->watching; spectator != NULL; spectator = next) {
+      next = spectator->next;
+      spectator->audience = NULL;
+      // Spectator has seen the end already
+      if(spectator->count == 0) { dropSpectator(spectator); }
+   }
+   free(audience);
+   return arrivals;
+}
+
+/* Function queues an update for a spectator and sends what
+   the socket takes. A spectator already as far behind as
+   allowed skips to this update or is dropped.
+*/
+void queueUpdate(Spectator *spectator, Update *update) {
+   // Spectator is too far behind
+   if(spectator->count == SPECTATOR_QUEUE) {
+      if(spectator->audience->policy == DROP_SLOW) {
+         dropSpectator(spectator);
+         return;
+      }
+      skipAhead(spectator);
+   }
+   update->refs++;
+   spectator->queue[(spectator->head + spectator->count) % SPECTATOR_QUEUE]
+      = update;
+   spectator->count++;
+   sendUpdates(spectator);
+}
+
+/* Function throws away every queued update a spectator has
+   not started sending. Each update holds the whole board, so
+   the next one queued stands in for all of them. The first
+   message is never thrown away.
+*/
+void skipAhead(Spectator *spectator) {
+   int keep = spectator->sent > 0 || !spectator->greeted ? 1 : 0, i;
+
+   for(i = keep; i < spectator->count; i++) {
+      releaseUpdate(spectator->queue[(spectator->head + i) % SPECTATOR_QUEUE]);
+   }
+   spectator->count = keep;
+}
+
+/* Function sends a spectator's queued updates in one call
+   for as long as the socket takes them, and waits for room
+   once it stops. A spectator of a game that is over is
+   closed once everything was sent.
+*/
+void sendUpdates(Spectator *spectator) {
+   struct iovec parts[SPECTATOR_QUEUE];
+   struct msghdr message;
+   Update *update;
+   int i, sent;
+
+   while(spectator->count > 0) {
+      for(i = 0; i < spectator->count; i++) {
+         update = spectator->queue[(spectator->head + i) % SPECTATOR_QUEUE];
+         parts[i].iov_base = update->data + (i == 0 ? spectator->sent : 0);
+         parts[i].iov_len = update->len - (i == 0 ? spectator->sent : 0);
+      }
+      memset(&message, 0, sizeof(message));
+      message.msg_iov = parts;
+      message.msg_iovlen = spectator->count;
+      sent = sendmsg(spectator->conn->fd, &message, MSG_NOSIGNAL);
+      if(sent < 0) {
+         if(errno == EINTR) { continue; }
+         // Socket is full, send the rest once it has room
+         if(errno == EAGAIN || errno == EWOULDBLOCK) { break; }
+         // Spectator is gone
+         dropSpectator(spectator);
+         return;
+      }
+      // Release every update sent in full
+      sent += spectator->sent;
+      while(spectator->count > 0
+            && sent >= spectator->queue[spectator->head]->len) {
+         sent -= spectator->queue[spectator->head]->len;
+         releaseUpdate(spectator->queue[spectator->head]);
+         spectator->head = (spectator->head + 1) % SPECTATOR_QUEUE;
+         spectator->count--;
+         spectator->greeted = 1;
+      }
+      spectator->sent = sent;
+   }
+   // Game is over and the spectator has seen all of it
+   if(spectator->count == 0 && spectator->audience == NULL) {
+      dropSpectator(spectator);
+      return;
+   }
+   if(spectator->conn->writing != (spectator->count > 0)) {
+      watchOutput(spectator->conn, spectator->count > 0);
+   }
+}
+
+/* Event handler called when a spectator's socket has room
+   for more updates, or the spectator sent data or left.
+   Anything a spectator sends is ignored.
+*/
+void watchSpectator(Connection *conn, int events) {
+   Spectator *spectator = (Spectator*) conn->owner;
+   char ignored[64];
+   int got;
+
+   // Socket can take more of the queued updates
+   if(events & EPOLLOUT) {
+      sendUpdates(spectator);
+      // Spectator was closed while sending
+      if(conn->owner != spectator) { return; }
+   }
+   if(events & (EPOLLIN|EPOLLRDHUP|EPOLLHUP|EPOLLERR)) {
+      while((got = recv(conn->fd, ignored, sizeof(ignored), 0)) > 0) {}
+      // Spectator left
+      if(got == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+         dropSpectator(spectator);
+      }
+   }
+}
+
+/* Function takes a spectator out of its audience, releases
+   its queued updates, and closes its connection.
+*/
+void dropSpectator(Spectator *spectator) {
+   Audience *audience = spectator->audience;
+
+   if(audience != NULL) {
+      if(spectator->prev != NULL) { spectator->prev->next = spectator->next; }
+      else { audience->watching = spectator->next; }
+      if(spectator->next != NULL) { spectator->next->prev = spectator->prev; }
+      audience->count--;
+   }
+   while(spectator->count > 0) {
+      releaseUpdate(spectator->queue[spectator->head]);
+      spectator->head = (spectator->head + 1) % SPECTATOR_QUEUE;
+      spectator->count--;
+   }
+   closeConnection(spectator->conn);
+   free(spectator);
+}
+
+/* Function drops one count of an update and frees it once
+   nobody has it left to send.
+*/
+void releaseUpdate(Update *update) {
+   update->refs--;
+   if(update->refs == 0) { free(update); }
+}
+
+/* Function doubles the buckets and chains every audience
+   again. The caller holds the table's lock.
+*/
+void growAudiences(AudienceTable *table) {
+   int cap = table->cap * 2;
+   Audience **buckets = (Audience**)calloc(cap, sizeof(Audience*));
+   Audience *audience, *next;
+   int i;
+
+   for(i = 0; i < table->cap; i++) {
+      for(audience = table->buckets[i]; audience != NULL; audience = next) {
+         next = audience->next;
+         audience->next = buckets[audience->id & (cap - 1)];
+         buckets[audience->id & (cap - 1)] = audience;
+      }
+   }
+   free(table->buckets);
+   table->buckets = buckets;
+   table->cap = cap;
+}
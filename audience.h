@@ -0,0 +1,71 @@
+/*
+This module lets spectators watch a live game. Each game
+has an audience found by the game's id. Every update of
+the game is built once into a shared buffer counted by
+how many spectators still have to send it, and each
+spectator sends from the shared buffers straight to its
+socket. A spectator who falls behind either skips ahead
+to the newest update or is dropped, so the players never
+wait on anyone watching.
+*/
+
+#ifndef AUDIENCE_H
+#define AUDIENCE_H
+
+#include <pthread.h>
+#include "reactor.h"
+#include "wire.h"
+
+#define SPECTATOR_QUEUE 16   // Updates a spectator may fall behind by
+#define SKIP_AHEAD 0         // Slow spectator skips to the newest update
+#define DROP_SLOW 1          // Slow spectator is disconnected
+
+typedef struct AUDIENCE Audience;
+typedef struct SPECTATOR Spectator;
+
+typedef struct UPDATE {
+   int refs;            // Spectators yet to send it, plus the publisher
+   int len;
+   char data[];
+}  Update;
+
+struct SPECTATOR {
+   Connection *conn;
+   Audience *audience;  // Game watched, NULL once it is over
+   Update *queue[SPECTATOR_QUEUE]; // Updates not yet sent, oldest first
+   int head;            // Index of the oldest update
+   int count;
+   int sent;            // Bytes of the oldest update already sent
+   int greeted;         // 1 once the first message was sent in full
+   Spectator *prev;
+   Spectator *next;
+};
+
+struct AUDIENCE {
+   int id;              // Game's id, never 0
+   int wakefd;          // eventfd of the game, written once a spectator arrives
+   int policy;          // SKIP_AHEAD or DROP_SLOW
+   Spectator *arriving; // Spectators waiting to be taken by the game
+   Spectator *watching; // Only used by the game's worker
+   int count;           // Spectators watching
+   Audience *next;      // Next audience in the same bucket
+};
+
+typedef struct AUDIENCETABLE {
+   Audience **buckets;  // Audiences chained by id
+   int cap;             // Always a power of two
+   int count;
+   int nextId;
+   pthread_mutex_t lock; // Guards the buckets and every audience's arrivals
+}  AudienceTable;
+
+AudienceTable *createAudiences(void);
+Audience *openAudience(AudienceTable *table, int wakefd, int policy);
+Audience *findAudience(AudienceTable *table, int id);
+void arriveSpectator(Audience *audience, Connection *conn);
+Spectator *takeArrivals(AudienceTable *table, Audience *audience);
+void addSpectator(Audience *audience, Spectator *spectator, Message *first);
+void publishUpdate(Audience *audience, Message *msg);
+Spectator *closeAudience(AudienceTable *table, Audience *audience);
+
+#endif
@@ -0,0 +1,390 @@
+/*
+Compile: gcc -O2 -o bench bench.c board.c wire.c -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc
+Run:     ./bench [-t ms] [-s seed] > bench.json
+
+This program times the board functions every move goes
+through, and building the messages sendUpdate and
+sendResult send, and prints the results as JSON: the
+nanoseconds and allocations each call takes. Each
+benchmark runs on a set of positions made up beforehand,
+either random positions of games still going on, or
+adversarial ones built so the function does the most work
+it can, such as a last move with one mark too few for a
+win along all four of its lines. Every benchmark is run
+on small, medium, and the largest boards, with calls
+doubled until it runs for at least ms milliseconds (-t).
+Allocations are counted by wrapping malloc, calloc, and
+realloc when linking, so only calls from the board and
+message code are counted. Another board representation is
+measured by adding its functions to the benchmark table.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "board.h"
+#include "wire.h"
+
+#define POSITIONS 256    // Positions made up for each benchmark
+#define MIN_CALLS 1024   // Calls made the first time a benchmark is timed
+
+typedef struct POSITIONSET {
+   char *kind;          // How the positions were made up
+   Board boards[POSITIONS];
+   int cells[POSITIONS]; // A free cell of each position, -1 if none
+   char movers[POSITIONS]; // Player who made each position's last move
+   int count;
+}  PositionSet;
+
+typedef long (*BenchFunction)(PositionSet *set, long calls);
+
+typedef struct BENCHMARK {
+   char *name;
+   BenchFunction function;
+}  Benchmark;
+
+typedef struct BOARDSHAPE {
+   int size;
+   int run;
+}  BoardShape;
+
+long allocations;       // Calls to malloc, calloc, and realloc so far
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void randomPositions(PositionSet *set, int size, int run);
+void adversarialPositions(PositionSet *set, int size, int run);
+int freeCell(Board *board);
+long benchInitBoard(PositionSet *set, long calls);
+long benchIsTaken(PositionSet *set, long calls);
+long benchMarkBoard(PositionSet *set, long calls);
+long benchCheckWin(PositionSet *set, long calls);
+long benchCheckDraw(PositionSet *set, long calls);
+long benchUpdatePayload(PositionSet *set, long calls);
+long benchResultPayload(PositionSet *set, long calls);
+void runBenchmark(Benchmark *bench, PositionSet *set, double minMs,
+                  int first);
+double clockNs(void);
+
+static Benchmark BENCHMARKS[] = {
+   { "initBoard", benchInitBoard },
+   { "isTaken", benchIsTaken },
+   { "markBoard+unmarkBoard", benchMarkBoard },
+   { "checkWin", benchCheckWin },
+   { "checkDraw", benchCheckDraw },
+   { "sendUpdate payload", benchUpdatePayload },
+   { "sendResult payload", benchResultPayload }
+};
+
+static BoardShape SHAPES[] = { {3, 3}, {9, 5}, {MAX_SIDE, 5} };
+
+/* Main function which makes up the positions for every
+   board shape and runs every benchmark on them.
+*/
+int main(int argc, char *argv[]) {
+   int benches = sizeof(BENCHMARKS) / sizeof(Benchmark);
+   int shapes = sizeof(SHAPES) / sizeof(BoardShape);
+   PositionSet *random = (PositionSet*)malloc(sizeof(PositionSet));
+   PositionSet *adversarial = (PositionSet*)malloc(sizeof(PositionSet));
+   unsigned int seed = 1;
+   double minMs = 200;
+   int option, shape, bench, first = 1;
+
+   // Read timing and seed options
+   while((option = getopt(argc, argv, "t:s:")) != -1) {
+      if(option == 't' && (minMs = atof(optarg)) <= 0) {
+         fprintf(stderr, "Benchmarks must run for some time\n");
+         exit(1);
+      }
+      else if(option == 's') { seed = strtoul(optarg, NULL, 10); }
+      else if(option == '?') { exit(1); }
+   }
+   srand(seed);
+
+   printf("{\n  \"seed\": %u,\n  \"min_ms\": %.0f,\n  \"benchmarks\": [\n",
+          seed, minMs);
+   for(shape = 0; shape < shapes; shape++) {
+      randomPositions(random, SHAPES[shape].size, SHAPES[shape].run);
+      adversarialPositions(adversarial, SHAPES[shape].size, SHAPES[shape].run);
+      for(bench = 0; bench < benches; bench++) {
+         runBenchmark(&BENCHMARKS[bench], random, minMs, first);
+         runBenchmark(&BENCHMARKS[bench], adversarial, minMs, 0);
+         first = 0;
+      }
+   }
+   printf("\n  ]\n}\n");
+   free(random);
+   free(adversarial);
+}
+
+/* Function times one benchmark on a set of positions,
+   doubling the calls until they take long enough, and
+   prints the result as a JSON object.
+*/
+void runBenchmark(Benchmark *bench, PositionSet *set, double minMs,
+                  int first) {
+   volatile long sink;
+   long calls = MIN_CALLS, allocated;
+   double started, took;
+
+   // Double the calls until the time is long enough to trust
+   while(1) {
+      allocated = allocations;
+      started = clockNs();
+      sink = bench->function(set, calls);
+      took = clockNs() - started;
+      allocated = allocations - allocated;
+      if(took >= minMs * 1e6) { break; }
+      calls *= 2;
+   }
+   (void) sink;
+   printf("%s    {\"name\": \"%s\", \"positions\": \"%s\", \"size\": %d, "
+          "\"run\": %d, \"calls\": %ld, \"ns_per_op\": %.3f, "
+          "\"allocs_per_op\": %.3f}", first ? "" : ",\n", bench->name,
+          set->kind, set->boards[0].size, set->boards[0].run, calls,
+          took / calls, (double) allocated / calls);
+   fflush(stdout);
+}
+
+/* Function makes up positions of games still going on: a
+   random number of random moves, made over again whenever
+   they win before the last one.
+*/
+void randomPositions(PositionSet *set, int size, int run) {
+   Board *board;
+   char turn;
+   int i, plies, ply, cell;
+
+   set->kind = "random";
+   set->count = POSITIONS;
+   for(i = 0; i < POSITIONS; i++) {
+      board = &set->boards[i];
+      do {
+         initBoard(board, size, run);
+         plies = 1 + rand() % (size * size - 1);
+         turn = PLAYER1;
+         for(ply = 0; ply < plies; ply++) {
+            // Take a random free cell
+            do { cell = rand() % (size * size); }
+            while(!isTaken(board, cell / size, cell % size));
+            markBoard(board, cell / size, cell % size, turn);
+            if(checkWin(board, turn) == 1) { break; }
+            turn = turn == PLAYER1 ? PLAYER2 : PLAYER1;
+         }
+      } while(ply < plies);
+      set->cells[i] = freeCell(board);
+      set->movers[i] = turn == PLAYER1 ? PLAYER2 : PLAYER1;
+   }
+}
+
+/* Function makes up the positions that make checkWin count
+   the longest: the last move is X's, away from the edges,
+   and each of the four lines through it holds one mark too
+   few to win, split as evenly as it can be on either side.
+   The rest of the board is O's, with a cell left free.
+*/
+void adversarialPositions(PositionSet *set, int size, int run) {
+   static const int STEPS[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+   Board *board;
+   int i, d, k, center, cell, spare, mi, mj;
+
+   set->kind = "adversarial";
+   set->count = POSITIONS;
+   for(i = 0; i < POSITIONS; i++) {
+      board = &set->boards[i];
+      initBoard(board, size, run);
+      // Move far enough from every edge for the lines to fit
+      mi = (run - 1) / 2 + rand() % (size - 2 * ((run - 1) / 2));
+      mj = (run - 1) / 2 + rand() % (size - 2 * ((run - 1) / 2));
+      center = mi * size + mj;
+      for(d = 0; d < 4; d++) {
+         // Marks before the move, then after it, run - 2 in all
+         for(k = 1; k <= (run - 2) / 2; k++) {
+            markBoard(board, mi - k * STEPS[d][0], mj - k * STEPS[d][1],
+                      PLAYER1);
+         }
+         for(k = 1; k <= run - 2 - (run - 2) / 2; k++) {
+            markBoard(board, mi + k * STEPS[d][0], mj + k * STEPS[d][1],
+                      PLAYER1);
+         }
+      }
+      // Fill the rest with O, leaving one cell besides the move free
+      do { spare = freeCell(board); } while(spare == center);
+      for(cell = 0; cell < size * size; cell++) {
+         if(cell != center && cell != spare
+            && isTaken(board, cell / size, cell % size)) {
+            markBoard(board, cell / size, cell % size, PLAYER2);
+         }
+      }
+      markBoard(board, mi, mj, PLAYER1);
+      set->cells[i] = spare;
+      set->movers[i] = PLAYER1;
+   }
+}
+
+/* Function gives a random free cell of a board, or -1 if
+   the board is full.
+*/
+int freeCell(Board *board) {
+   int cells = board->size * board->size, start = rand() % cells, k, cell;
+
+   for(k = 0; k < cells; k++) {
+      cell = (start + k) % cells;
+      if(isTaken(board, cell / board->size, cell % board->size)) {
+         return cell;
+      }
+   }
+   return -1;
+}
+
+/* Benchmark sets up a board of each position's shape.
+*/
+long benchInitBoard(PositionSet *set, long calls) {
+   Board board;
+   long call, sum = 0;
+
+   for(call = 0; call < calls; call++) {
+      initBoard(&board, set->boards[call % set->count].size,
+                set->boards[call % set->count].run);
+      sum += board.last;
+   }
+   return sum;
+}
+
+/* Benchmark asks whether the cells of each position are
+   taken, in turn.
+*/
+long benchIsTaken(PositionSet *set, long calls) {
+   Board *board;
+   long call, sum = 0;
+   int cell;
+
+   for(call = 0; call < calls; call++) {
+      board = &set->boards[call % set->count];
+      cell = call % (board->size * board->size);
+      sum += isTaken(board, cell / board->size, cell % board->size);
+   }
+   return sum;
+}
+
+/* Benchmark marks a free cell of each position and takes
+   the move back, which leaves the position as it was.
+*/
+long benchMarkBoard(PositionSet *set, long calls) {
+   Board *board;
+   long call, sum = 0;
+   int cell, last;
+
+   for(call = 0; call < calls; call++) {
+      board = &set->boards[call % set->count];
+      cell = set->cells[call % set->count];
+      // Full boards have no move to make
+      if(cell < 0) { continue; }
+      last = board->last;
+      markBoard(board, cell / board->size, cell % board->size, PLAYER2);
+      sum += board->moves;
+      unmarkBoard(board, cell / board->size, cell % board->size, PLAYER2,
+                  last);
+   }
+   return sum;
+}
+
+/* Benchmark checks whether the last move of each position
+   won for the player who made it.
+*/
+long benchCheckWin(PositionSet *set, long calls) {
+   long call, sum = 0;
+
+   for(call = 0; call < calls; call++) {
+      sum += checkWin(&set->boards[call % set->count],
+                      set->movers[call % set->count]);
+   }
+   return sum;
+}
+
+/* Benchmark checks whether each position is a draw.
+*/
+long benchCheckDraw(PositionSet *set, long calls) {
+   long call, sum = 0;
+
+   for(call = 0; call < calls; call++) {
+      sum += checkDraw(&set->boards[call % set->count]);
+   }
+   return sum;
+}
+
+/* Benchmark builds what sendUpdate adds for both players:
+   the game status and the board, for each of them.
+*/
+long benchUpdatePayload(PositionSet *set, long calls) {
+   Message toX, toO;
+   Board *board;
+   long call, sum = 0;
+
+   for(call = 0; call < calls; call++) {
+      board = &set->boards[call % set->count];
+      initMessage(&toX);
+      initMessage(&toO);
+      putInt(&toX, -1);
+      putBoard(&toX, board);
+      putInt(&toO, -1);
+      putBoard(&toO, board);
+      sum += toX.len + toO.len;
+   }
+   return sum;
+}
+
+/* Benchmark builds what sendResult adds once a player won:
+   1 and the board for the winner, 0 and the board for the
+   loser.
+*/
+long benchResultPayload(PositionSet *set, long calls) {
+   Message winner, loser;
+   Board *board;
+   long call, sum = 0;
+
+   for(call = 0; call < calls; call++) {
+      board = &set->boards[call % set->count];
+      initMessage(&winner);
+      initMessage(&loser);
+      putInt(&winner, 1);
+      putBoard(&winner, board);
+      putInt(&loser, 0);
+      putBoard(&loser, board);
+      sum += winner.len + loser.len;
+   }
+   return sum;
+}
+
+/* Function counts a call to malloc and makes it.
+*/
+void *__wrap_malloc(size_t size) {
+   allocations++;
+   return __real_malloc(size);
+}
+
+/* Function counts a call to calloc and makes it.
+*/
+void *__wrap_calloc(size_t count, size_t size) {
+   allocations++;
+   return __real_calloc(count, size);
+}
+
+/* Function counts a call to realloc and makes it.
+*/
+void *__wrap_realloc(void *ptr, size_t size) {
+   allocations++;
+   return __real_realloc(ptr, size);
+}
+
+/* Function gets the time on the monotonic clock in
+   nanoseconds.
+*/
+double clockNs(void) {
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return now.tv_sec * 1e9 + now.tv_nsec;
+}
@@ -0,0 +1,197 @@
+/*
+This module holds the tic-tac-toe board as a pair of
+bit masks. Marking a cell sets one bit, a win is looked
+for only along the four lines through the last move, and
+a draw is found by counting moves, so no check has to
+look at every cell of a large board.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "board.h"
+
+#define HAS(mask, cell) ((mask)[(cell) / 32] >> ((cell) % 32) & 1)
+
+// Row, column, and diagonal steps through a cell
+static const int DIRECTIONS[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+
+int countRun(Board *board, unsigned int *mine, int i, int j, int di, int dj);
+
+/* Function empties the board and sets its size and the
+   number of marks in a row which wins.
+*/
+void initBoard(Board *board, int size, int run) {
+   memset(board, 0, sizeof(Board));
+   board->size = size;
+   board->run = run;
+   board->last = -1;
+}
+
+/* Function determines if coordinates are on the board.
+*/
+int onBoard(Board *board, int msgx, int msgy) {
+   return msgx >= 0 && msgx < board->size && msgy >= 0 && msgy < board->size;
+}
+
+/* Function determines if location on board is taken.
+   If it is returns a 0, if not returns a 1.
+*/
+int isTaken(Board *board, int msgx, int msgy) {
+   int cell = msgx*board->size + msgy;
+
+   // Location not taken
+   if(!HAS(board->x, cell) && !HAS(board->o, cell)) {
+      return 1;
+   }
+   // Location is taken
+   return 0;
+}
+
+/* Function marks location on the board with
+   specified player's symbol.
+*/
+void markBoard(Board *board, int msgx, int msgy, char playerSymbol) {
+   int cell = msgx*board->size + msgy;
+   unsigned int *mine = playerSymbol == PLAYER1 ? board->x : board->o;
+
+   mine[cell / 32] |= 1u << (cell % 32);
+   board->last = cell;
+   board->moves++;
+}
+
+/* Function takes back a move, restoring the cell taken
+   by the move before it.
+*/
+void unmarkBoard(Board *board, int msgx, int msgy, char playerSymbol, int last) {
+   int cell = msgx*board->size + msgy;
+   unsigned int *mine = playerSymbol == PLAYER1 ? board->x : board->o;
+
+   mine[cell / 32] &= ~(1u << (cell % 32));
+   board->last = last;
+   board->moves--;
+}
+
+/* Check to see if the last move won the game. Only the
+   lines through the last move are counted, since no other
+   line can have changed. Returns 1 if it has, and -1 if
+   it hasn't.
+*/
+int checkWin(Board *board, char playerSymbol) {
+   unsigned int *mine = playerSymbol == PLAYER1 ? board->x : board->o;
+   int i, j, d, count;
+
+   // No move has been made yet
+   if(board->last == -1) { return -1; }
+   i = board->last / board->size;
+   j = board->last % board->size;
+   for(d = 0; d < 4; d++) {
+      // Marks in a row both ways from the last move, plus the move
+      count = 1 + countRun(board, mine, i, j, DIRECTIONS[d][0], DIRECTIONS[d][1])
+                + countRun(board, mine, i, j, -DIRECTIONS[d][0], -DIRECTIONS[d][1]);
+      if(count >= board->run) {
+         return 1;
+      }
+   }
+   return -1;
+}
+
+/* Function counts the player's marks in a row starting next
+   to cell (i, j) and stepping by (di, dj), stopping once
+   enough for a win have been counted.
+*/
+int countRun(Board *board, unsigned int *mine, int i, int j, int di, int dj) {
+   int count = 0;
+
+   i += di;
+   j += dj;
+   while(count < board->run - 1 && onBoard(board, i, j)
+         && HAS(mine, i*board->size + j)) {
+      count++;
+      i += di;
+      j += dj;
+   }
+   return count;
+}
+
+/* Function checks board for a draw. Returns 2 if every
+   cell is taken, and -1 if not.
+*/
+int checkDraw(Board *board) {
+   // If a empty location on board exists, no draw
+   if(board->moves < board->size * board->size) {
+      return -1;
+   }
+   return 2;
+}
+
+/* Function gets the symbol at given
+   location on the board.
+*/
+char getSymbol(Board *board, int i, int j) {
+   int cell = i*board->size + j;
+
+   if(HAS(board->x, cell)) { return PLAYER1; }
+   if(HAS(board->o, cell)) { return PLAYER2; }
+   return EMPTY;
+}
+
+/* Print the tic-tac-toe board.
+*/
+void printBoard(Board *board) {
+   for(int i = 0; i < board->size; i++) {
+      for(int j = 0; j < board->size; j++) {
+         printf("%c ", getSymbol(board, i, j));
+      }
+      printf("\n");
+   }
+   printf("\n");
+}
+
+/* Function gives the number of words each player's mask
+   takes on this board, which is how many are sent for each.
+*/
+int boardWords(Board *board) {
+   return (board->size * board->size + 31) / 32;
+}
+
+/* Function gives the base 3 index of a 3 x 3 board, cell
+   i counting 0, 1, or 2 times 3 to the i for empty, X, or O.
+*/
+int boardIndex(Board *board) {
+   int index = 0, cell;
+
+   for(cell = 8; cell >= 0; cell--) {
+      index *= 3;
+      switch(getSymbol(board, cell / 3, cell % 3)) {
+      case PLAYER1: index += 1; break;
+      case PLAYER2: index += 2; break;
+      }
+   }
+   return index;
+}
+
+/* Function adds the board to a message as X's mask followed
+   by O's mask.
+*/
+void putBoard(Message *msg, Board *board) {
+   int i, words = boardWords(board);
+
+   for(i = 0; i < words; i++) { putInt(msg, board->x[i]); }
+   for(i = 0; i < words; i++) { putInt(msg, board->o[i]); }
+}
+
+/* Function receives a board sent by putBoard into a board
+   of the same size. Returns 0 on success and -1 if the peer
+   is gone.
+*/
+int readBoard(Reader *reader, Board *board) {
+   int i, words = boardWords(board);
+
+   for(i = 0; i < words; i++) {
+      if(readInt(reader, (int*)&board->x[i]) == -1) { return -1; }
+   }
+   for(i = 0; i < words; i++) {
+      if(readInt(reader, (int*)&board->o[i]) == -1) { return -1; }
+   }
+   return 0;
+}
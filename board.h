@@ -0,0 +1,43 @@
+/*
+This module holds a tic-tac-toe board of any size up to
+MAX_SIDE cells a side, won by getting run marks in a row.
+Each player's cells are a bit mask, cell (i, j) being bit
+i*size + j, and the same masks are what is sent to players
+and what is stored.
+*/
+
+#ifndef BOARD_H
+#define BOARD_H
+
+#include "wire.h"
+
+#define PLAYER1 'X'
+#define PLAYER2 'O'
+#define EMPTY '-'
+#define MAX_SIDE 19      // Largest board is 19 x 19
+#define BOARD_WORDS ((MAX_SIDE * MAX_SIDE + 31) / 32)
+
+typedef struct BOARD {
+   int size;            // Cells per side
+   int run;             // Marks in a row needed to win
+   int moves;           // Cells taken so far
+   int last;            // Cell taken by the last move, -1 if none
+   unsigned int x[BOARD_WORDS]; // Cells taken by X
+   unsigned int o[BOARD_WORDS]; // Cells taken by O
+}  Board;
+
+void initBoard(Board *board, int size, int run);
+int isTaken(Board *board, int msgx, int msgy);
+int onBoard(Board *board, int msgx, int msgy);
+void markBoard(Board *board, int msgx, int msgy, char playerSymbol);
+void unmarkBoard(Board *board, int msgx, int msgy, char playerSymbol, int last);
+int checkWin(Board *board, char playerSymbol);
+int checkDraw(Board *board);
+char getSymbol(Board *board, int i, int j);
+void printBoard(Board *board);
+int boardWords(Board *board);
+int boardIndex(Board *board);
+void putBoard(Message *msg, Board *board);
+int readBoard(Reader *reader, Board *board);
+
+#endif
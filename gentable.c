@@ -0,0 +1,105 @@
+/*
+Compile: gcc -o gentable gentable.c board.c wire.c
+Run:     ./gentable > perfect-table.h
+
+This program solves every position of the 3 x 3 game
+and writes the best move and value of each as a table
+the server includes, so the computer never has to search
+the standard board. Positions are solved with the same
+board functions the server plays with.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "board.h"
+#include "perfect.h"
+
+#define POSITIONS 19683 // 3 to the 9th
+
+unsigned char table[POSITIONS];
+int length[POSITIONS];   // Moves until the game ends with best play
+
+void solve(Board *board, char side);
+void writeTable(void);
+
+/* Main function which solves the game from the empty
+   board and prints the table.
+*/
+int main(void) {
+   Board board;
+
+   memset(table, PERFECT_NONE, sizeof(table));
+   initBoard(&board, 3, 3);
+   solve(&board, PLAYER1);
+   writeTable();
+   return 0;
+}
+
+/* Function solves the position for side, the player about
+   to move, and every position reachable from it. The best
+   move wins soonest, or failing that loses latest.
+*/
+void solve(Board *board, char side) {
+   int index = boardIndex(board);
+   char other = side == PLAYER1 ? PLAYER2 : PLAYER1;
+   int cell, last, child, value, best = -1, bestCell = 0, bestLength = 0;
+
+   // Position was already solved by another order of moves
+   if(table[index] != PERFECT_NONE) { return; }
+   // Player who just moved has won
+   if(checkWin(board, other) == 1) {
+      table[index] = PERFECT_LOSS << 4 | PERFECT_END;
+      length[index] = 0;
+      return;
+   }
+   // Every cell is taken
+   if(checkDraw(board) == 2) {
+      table[index] = PERFECT_DRAW << 4 | PERFECT_END;
+      length[index] = 0;
+      return;
+   }
+   for(cell = 0; cell < 9; cell++) {
+      if(isTaken(board, cell / 3, cell % 3) == 0) { continue; }
+      last = board->last;
+      markBoard(board, cell / 3, cell % 3, side);
+      solve(board, other);
+      child = boardIndex(board);
+      unmarkBoard(board, cell / 3, cell % 3, side, last);
+
+      // Value for side is the opposite of the value for other
+      value = PERFECT_WIN - PERFECT_VALUE(table[child]);
+      if(value > best
+         || (value == best && value == PERFECT_WIN
+             && length[child] + 1 < bestLength)
+         || (value == best && value != PERFECT_WIN
+             && length[child] + 1 > bestLength)) {
+         best = value;
+         bestCell = cell;
+         bestLength = length[child] + 1;
+      }
+   }
+   table[index] = best << 4 | bestCell;
+   length[index] = bestLength;
+}
+
+/* Function prints the table as a C header.
+*/
+void writeTable(void) {
+   int i, solved = 0;
+
+   for(i = 0; i < POSITIONS; i++) {
+      if(table[i] != PERFECT_NONE) { solved++; }
+   }
+   printf("/*\n");
+   printf("Generated by gentable, do not edit. Holds the value and\n");
+   printf("best move of each of the %d positions of the 3 x 3\n", solved);
+   printf("game that can be reached, at the board's base 3 index.\n");
+   printf("*/\n\n");
+   printf("#ifndef PERFECT_TABLE_H\n#define PERFECT_TABLE_H\n\n");
+   printf("static const unsigned char PERFECT[%d] = {\n", POSITIONS);
+   for(i = 0; i < POSITIONS; i++) {
+      printf("%s0x%02x,%s", i % 12 == 0 ? "   " : "", table[i],
+             i % 12 == 11 || i == POSITIONS - 1 ? "\n" : " ");
+   }
+   printf("};\n\n#endif\n");
+}
@@ -0,0 +1,316 @@
+/*
+This module keeps the journal of every game. A game is
+its fixed header followed by one cell per move, a byte
+each on boards of up to 256 cells and two bytes on larger
+ones, padded so the next game starts aligned. The server
+never reopens a segment: each run starts the next one, so
+a game cut short by a crash can only be at the end of a
+segment, where the reader sees it does not fit and moves
+on to the next segment.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "journal.h"
+#include "registry.h"
+
+void *journalThread(void *args);
+int startSegment(Journal *journal);
+void segmentPath(char *path, int size, char *dir, int segment);
+int mapSegment(JournalReader *reader);
+int validGame(JournalGame *game, long room);
+long gameSize(JournalGame *game);
+int writeSegment(int fd, char *data, int size);
+
+/* Function opens the journal kept in dir, starting a new
+   segment after any left by earlier runs, and starts the
+   thread which writes it. Returns NULL if the segment could
+   not be created.
+*/
+Journal *openJournal(char *dir) {
+   Journal *journal = (Journal*)calloc(1, sizeof(Journal));
+   int first, last;
+
+   journal->dir = dir;
+   mkdir(dir, S_IRWXU);
+   journal->segment = findSegments(dir, &first, &last) > 0 ? last + 1 : 1;
+   // First segment could not be created
+   if(startSegment(journal) == -1) {
+      free(journal);
+      return NULL;
+   }
+   pthread_mutex_init(&journal->lock, NULL);
+   pthread_cond_init(&journal->added, NULL);
+   pthread_create(&journal->thread, NULL, journalThread, journal);
+   return journal;
+}
+
+/* Function appends a finished game and the cell of each of
+   its moves, in order, to the games waiting to be written.
+*/
+void journalGame(Journal *journal, JournalGame *game, short *cells) {
+   long size = gameSize(game);
+   int wide = game->size * game->size > 256;
+   char *at;
+   int ply;
+
+   pthread_mutex_lock(&journal->lock);
+   // Grow the pending games while the writer is behind
+   if(journal->pendingSize + size > journal->pendingCap) {
+      while(journal->pendingSize + size > journal->pendingCap) {
+         journal->pendingCap = journal->pendingCap == 0 ? 4096
+                               : journal->pendingCap * 2;
+      }
+      journal->pending = (char*)realloc(journal->pending, journal->pendingCap);
+   }
+   at = journal->pending + journal->pendingSize;
+   memset(at, 0, size);
+   memcpy(at, game, sizeof(JournalGame));
+   at += sizeof(JournalGame);
+   for(ply = 0; ply < game->plies; ply++) {
+      if(wide) { ((unsigned short*) at)[ply] = cells[ply]; }
+      else { ((unsigned char*) at)[ply] = cells[ply]; }
+   }
+   journal->pendingSize += size;
+   pthread_cond_signal(&journal->added);
+   pthread_mutex_unlock(&journal->lock);
+}
+
+/* Thread function which writes every game appended while it
+   was busy in one group, and starts the next segment once
+   the current one is full. It sleeps while there is nothing
+   to write.
+*/
+void *journalThread(void *args) {
+   Journal *journal = (Journal*) args;
+   char *games = NULL, *spare;
+   int size, cap = 0, spareCap;
+
+   while(1) {
+      pthread_mutex_lock(&journal->lock);
+      while(journal->pendingSize == 0) {
+         pthread_cond_wait(&journal->added, &journal->lock);
+      }
+      // Take the pending games and leave the spare buffer for appends
+      spare = games;
+      games = journal->pending;
+      size = journal->pendingSize;
+      journal->pending = spare;
+      journal->pendingSize = 0;
+      spareCap = cap;
+      cap = journal->pendingCap;
+      journal->pendingCap = spareCap;
+      pthread_mutex_unlock(&journal->lock);
+
+      writeSegment(journal->fd, games, size);
+      journal->segmentSize += size;
+      // Segment is full, later games go to the next one
+      if(journal->segmentSize >= JOURNAL_SEGMENT) {
+         fdatasync(journal->fd);
+         close(journal->fd);
+         journal->segment++;
+         // Next segment could not be created, later games are lost
+         if(startSegment(journal) == -1) {
+            printf("Journal segment %d could not be created\n",
+                   journal->segment);
+         }
+      }
+   }
+}
+
+/* Function creates the journal's current segment and writes
+   its header. Returns 0, or -1 if it could not be created.
+*/
+int startSegment(Journal *journal) {
+   char path[256];
+   char header[JOURNAL_HEADER];
+   JournalHeader *fields = (JournalHeader*) header;
+
+   segmentPath(path, sizeof(path), journal->dir, journal->segment);
+   journal->fd = open(path, O_CREAT|O_WRONLY|O_TRUNC|O_APPEND,
+                      S_IRUSR|S_IWUSR);
+   // Segment could not be created
+   if(journal->fd == -1) { return -1; }
+   memset(header, 0, JOURNAL_HEADER);
+   memcpy(fields->magic, JOURNAL_MAGIC, sizeof(fields->magic));
+   fields->version = JOURNAL_VERSION;
+   fields->headerSize = JOURNAL_HEADER;
+   journal->segmentSize = JOURNAL_HEADER;
+   return writeSegment(journal->fd, header, JOURNAL_HEADER);
+}
+
+/* Function opens a reader at the first game of segment
+   first of the journal kept in dir, which reads up to the
+   end of segment last. Segments in the range that are
+   missing are skipped.
+*/
+JournalReader *openReader(char *dir, int first, int last) {
+   JournalReader *reader = (JournalReader*)calloc(1, sizeof(JournalReader));
+
+   reader->dir = dir;
+   reader->segment = first - 1;
+   reader->lastSegment = last;
+   return reader;
+}
+
+/* Function gives the next game of the journal, mapping the
+   next segment once the current one runs out. The game is
+   read in place and stays mapped until the reader moves on
+   from its segment. Returns NULL after the last game.
+*/
+JournalGame *nextGame(JournalReader *reader) {
+   JournalGame *game;
+
+   while(1) {
+      // Game at the reader's offset is whole
+      if(reader->map != NULL) {
+         game = (JournalGame*) (reader->map + reader->at);
+         if(validGame(game, reader->mapSize - reader->at)) {
+            reader->at += gameSize(game);
+            return game;
+         }
+         munmap(reader->map, reader->mapSize);
+         reader->map = NULL;
+      }
+      // Every segment was read
+      if(reader->segment >= reader->lastSegment) { return NULL; }
+      reader->segment++;
+      mapSegment(reader);
+   }
+}
+
+/* Function gives the cell taken by a move of a game read
+   from the journal.
+*/
+int gameCell(JournalGame *game, int ply) {
+   unsigned char *cells = (unsigned char*) (game + 1);
+
+   if(game->size * game->size > 256) {
+      return ((unsigned short*) cells)[ply];
+   }
+   return cells[ply];
+}
+
+/* Function closes a reader and unmaps its segment.
+*/
+void closeReader(JournalReader *reader) {
+   if(reader->map != NULL) { munmap(reader->map, reader->mapSize); }
+   free(reader);
+}
+
+/* Function maps the reader's segment and places the reader
+   at its first game. A segment that is missing, empty, or
+   not a journal segment of this version is left unmapped.
+   Returns 0 if the segment was mapped and -1 if not.
+*/
+int mapSegment(JournalReader *reader) {
+   JournalHeader *header;
+   struct stat info;
+   char path[256];
+   int fd;
+
+   segmentPath(path, sizeof(path), reader->dir, reader->segment);
+   fd = open(path, O_RDONLY);
+   // Segment is gone or was never created
+   if(fd == -1) { return -1; }
+   if(fstat(fd, &info) == -1 || info.st_size < JOURNAL_HEADER) {
+      close(fd);
+      return -1;
+   }
+   reader->mapSize = info.st_size;
+   reader->map = mmap(NULL, reader->mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if(reader->map == MAP_FAILED) {
+      reader->map = NULL;
+      return -1;
+   }
+   // Games are read front to back once
+   madvise(reader->map, reader->mapSize, MADV_SEQUENTIAL);
+   header = (JournalHeader*) reader->map;
+   // Segment was written by another program or layout
+   if(memcmp(header->magic, JOURNAL_MAGIC, sizeof(header->magic)) != 0
+      || header->version != JOURNAL_VERSION
+      || header->headerSize < (int) sizeof(JournalHeader)
+      || header->headerSize > reader->mapSize) {
+      munmap(reader->map, reader->mapSize);
+      reader->map = NULL;
+      return -1;
+   }
+   reader->at = header->headerSize;
+   return 0;
+}
+
+/* Function tells whether a game fits in the room left in its
+   segment and holds a game the server could have played,
+   between players the scoreboard has room for.
+*/
+int validGame(JournalGame *game, long room) {
+   return room >= (long) sizeof(JournalGame)
+          && game->size >= 3 && game->size <= MAX_SIDE
+          && game->run >= 3 && game->run <= game->size
+          && game->plies >= 0 && game->plies <= game->size * game->size
+          && game->result <= DRAWN
+          && game->playerX >= 0 && game->playerX < MAX_BLOCKS * BLOCK_SIZE
+          && game->playerO >= 0 && game->playerO < MAX_BLOCKS * BLOCK_SIZE
+          && gameSize(game) <= room;
+}
+
+/* Function gives the bytes a game takes in a segment.
+*/
+long gameSize(JournalGame *game) {
+   int cellSize = game->size * game->size > 256 ? 2 : 1;
+   long size = sizeof(JournalGame) + (long) game->plies * cellSize;
+
+   return (size + JOURNAL_ALIGN - 1) / JOURNAL_ALIGN * JOURNAL_ALIGN;
+}
+
+/* Function finds the lowest and highest numbered segments
+   in dir. Returns the number of segments found.
+*/
+int findSegments(char *dir, int *first, int *last) {
+   DIR *entries = opendir(dir);
+   struct dirent *entry;
+   int segment, found = 0;
+   char end;
+
+   // Journal has never been written
+   if(entries == NULL) { return 0; }
+   while((entry = readdir(entries)) != NULL) {
+      // Name is not a segment's
+      if(sscanf(entry->d_name, "games-%d.jn%c", &segment, &end) != 2
+         || end != 'l' || segment < 1) {
+         continue;
+      }
+      if(found == 0 || segment < *first) { *first = segment; }
+      if(found == 0 || segment > *last) { *last = segment; }
+      found++;
+   }
+   closedir(entries);
+   return found;
+}
+
+/* Function gives the path of a numbered segment in dir.
+*/
+void segmentPath(char *path, int size, char *dir, int segment) {
+   snprintf(path, size, "%s/games-%06d.jnl", dir, segment);
+}
+
+/* Function writes all of data, continuing after short
+   writes. Returns 0, or -1 on error.
+*/
+int writeSegment(int fd, char *data, int size) {
+   int written = 0, got;
+
+   while(written < size) {
+      got = write(fd, data + written, size - written);
+      if(got <= 0) { return -1; }
+      written += got;
+   }
+   return 0;
+}
@@ -0,0 +1,75 @@
+/*
+This module keeps a journal of every game played: who
+played it, when it started, each move in order, and how
+it ended. Games are appended by their own thread in
+groups to numbered segment files which are only ever
+appended to, and a reader maps the segments one at a
+time and walks the games in place, so reading the
+journal never touches the server.
+*/
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <pthread.h>
+#include "board.h"
+
+#define JOURNAL_DIR "journal"
+#define JOURNAL_MAGIC "\x89TTJ\r\n\x1a\n" // Never the start of a game
+#define JOURNAL_VERSION 1    // Raised whenever the layout changes
+#define JOURNAL_HEADER 64    // Bytes before the first game of a segment
+#define JOURNAL_SEGMENT (64 << 20) // Segment size at which the next is started
+#define JOURNAL_ALIGN 8      // Every game starts a multiple of this into a segment
+#define ABANDONED 0          // Result of a game nobody finished
+#define X_WON 1
+#define O_WON 2
+#define DRAWN 3
+
+typedef struct JOURNALHEADER {
+   char magic[8];
+   int version;
+   int headerSize;      // Bytes before the first game
+}  JournalHeader;
+
+typedef struct JOURNALGAME {
+   int playerX;         // Location of player X on scoreboard
+   int playerO;         // Location of player O on scoreboard
+   long long started;   // Milliseconds since the epoch
+   int plies;           // Moves made, which follow the game
+   unsigned char size;  // Cells per side
+   unsigned char run;   // Marks in a row needed to win
+   unsigned char result; // ABANDONED, X_WON, O_WON, or DRAWN
+   unsigned char computer; // Symbol the computer played, 0 if none
+}  JournalGame;
+
+typedef struct JOURNAL {
+   char *dir;
+   int fd;              // Segment being appended to
+   int segment;         // Number of that segment
+   long segmentSize;
+   pthread_t thread;
+   pthread_mutex_t lock; // Guards the pending games
+   pthread_cond_t added; // Signaled when games are appended
+   char *pending;       // Games appended but not yet written
+   int pendingSize;
+   int pendingCap;
+}  Journal;
+
+typedef struct JOURNALREADER {
+   char *dir;
+   int segment;         // Number of the segment mapped
+   int lastSegment;     // Last segment to read
+   char *map;           // Segment being read, NULL before the first
+   long mapSize;
+   long at;             // Offset of the next game in the segment
+}  JournalReader;
+
+Journal *openJournal(char *dir);
+void journalGame(Journal *journal, JournalGame *game, short *cells);
+int findSegments(char *dir, int *first, int *last);
+JournalReader *openReader(char *dir, int first, int last);
+JournalGame *nextGame(JournalReader *reader);
+int gameCell(JournalGame *game, int ply);
+void closeReader(JournalReader *reader);
+
+#endif
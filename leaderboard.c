@@ -0,0 +1,246 @@
+/*
+This module ranks every player by score. The tree is a
+treap: ordered by score, highest first, with players of
+equal score in order of registration, and shaped by a
+priority mixed from each player's location so it stays
+balanced whatever order scores arrive in. Nodes live in
+one array by location, so no node is ever allocated on
+its own.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "leaderboard.h"
+
+int ranksBefore(Leaderboard *leaders, int a, int b);
+int insertNode(Leaderboard *leaders, int tree, int loc);
+int removeNode(Leaderboard *leaders, int tree, int loc);
+void splitTree(Leaderboard *leaders, int tree, int loc, int *before,
+               int *after);
+int mergeTrees(Leaderboard *leaders, int before, int after);
+int treeSize(Leaderboard *leaders, int tree);
+void resize(Leaderboard *leaders, int tree);
+
+/* Function creates an empty leaderboard which ranks the
+   players of the scoreboard by score.
+*/
+Leaderboard *createLeaderboard(Registry *scoreboard, LeaderScore score) {
+   Leaderboard *leaders = (Leaderboard*)calloc(1, sizeof(Leaderboard));
+
+   leaders->scoreboard = scoreboard;
+   leaders->score = score;
+   leaders->root = -1;
+   pthread_mutex_init(&leaders->lock, NULL);
+   return leaders;
+}
+
+/* Function places a player by their current score, first
+   taking them out if they were already ranked. The player
+   is copied under the leaderboard's lock, so the last game
+   of a player to be ranked is their latest.
+*/
+void rankPlayer(Leaderboard *leaders, int loc) {
+   PlayerRecord record;
+   LeaderNode *node;
+   int cap;
+
+   pthread_mutex_lock(&leaders->lock);
+   // Grow the nodes to cover new players
+   if(loc >= leaders->cap) {
+      cap = leaders->cap == 0 ? 1024 : leaders->cap;
+      while(loc >= cap) { cap *= 2; }
+      leaders->nodes = (LeaderNode*)realloc(leaders->nodes,
+                                            cap * sizeof(LeaderNode));
+      memset(leaders->nodes + leaders->cap, 0,
+             (cap - leaders->cap) * sizeof(LeaderNode));
+      leaders->cap = cap;
+   }
+   node = &leaders->nodes[loc];
+   if(node->placed) { leaders->root = removeNode(leaders, leaders->root, loc); }
+   copyPlayer(leaders->scoreboard, loc, &record);
+   node->score = leaders->score(&record);
+   node->left = -1;
+   node->right = -1;
+   node->size = 1;
+   node->priority = (unsigned int) loc * 2654435761u;
+   node->priority ^= node->priority >> 15;
+   node->placed = 1;
+   leaders->root = insertNode(leaders, leaders->root, loc);
+   pthread_mutex_unlock(&leaders->lock);
+}
+
+/* Function gives the number of players ranked.
+*/
+int countRanked(Leaderboard *leaders) {
+   int count;
+
+   pthread_mutex_lock(&leaders->lock);
+   count = treeSize(leaders, leaders->root);
+   pthread_mutex_unlock(&leaders->lock);
+   return count;
+}
+
+/* Function gives a player's rank, 1 for the highest score.
+   Returns 0 if the player is not ranked.
+*/
+int playerRank(Leaderboard *leaders, int loc) {
+   int tree, rank = 0;
+
+   pthread_mutex_lock(&leaders->lock);
+   // Player has never been placed
+   if(loc < 0 || loc >= leaders->cap || !leaders->nodes[loc].placed) {
+      pthread_mutex_unlock(&leaders->lock);
+      return 0;
+   }
+   tree = leaders->root;
+   // Count every player ranked above on the way down
+   while(tree != loc) {
+      if(ranksBefore(leaders, loc, tree)) { tree = leaders->nodes[tree].left; }
+      else {
+         rank += treeSize(leaders, leaders->nodes[tree].left) + 1;
+         tree = leaders->nodes[tree].right;
+      }
+   }
+   rank += treeSize(leaders, leaders->nodes[loc].left) + 1;
+   pthread_mutex_unlock(&leaders->lock);
+   return rank;
+}
+
+/* Function finds the players ranked first to first + count
+   - 1 and puts their locations in locs, highest first.
+   Returns the number of players found.
+*/
+int rankedPlayers(Leaderboard *leaders, int first, int count, int *locs) {
+   int found, rank, tree, left;
+
+   pthread_mutex_lock(&leaders->lock);
+   for(found = 0; found < count; found++) {
+      rank = first + found;
+      // No one is ranked this low
+      if(rank < 1 || rank > treeSize(leaders, leaders->root)) { break; }
+      tree = leaders->root;
+      // Go down toward the subtree holding the rank
+      while(1) {
+         left = treeSize(leaders, leaders->nodes[tree].left);
+         if(rank <= left) { tree = leaders->nodes[tree].left; }
+         else if(rank == left + 1) { break; }
+         else {
+            rank -= left + 1;
+            tree = leaders->nodes[tree].right;
+         }
+      }
+      locs[found] = tree;
+   }
+   pthread_mutex_unlock(&leaders->lock);
+   return found;
+}
+
+/* Function tells whether player a is ranked above player b:
+   a higher score, or the same score and registered first.
+*/
+int ranksBefore(Leaderboard *leaders, int a, int b) {
+   int scoreA = leaders->nodes[a].score;
+   int scoreB = leaders->nodes[b].score;
+
+   return scoreA > scoreB || (scoreA == scoreB && a < b);
+}
+
+/* Function adds a player to a subtree. Returns the root of
+   the subtree.
+*/
+int insertNode(Leaderboard *leaders, int tree, int loc) {
+   LeaderNode *node = &leaders->nodes[loc];
+
+   // Player belongs at the top of this subtree
+   if(tree == -1 || node->priority > leaders->nodes[tree].priority) {
+      splitTree(leaders, tree, loc, &node->left, &node->right);
+      resize(leaders, loc);
+      return loc;
+   }
+   if(ranksBefore(leaders, loc, tree)) {
+      leaders->nodes[tree].left = insertNode(leaders,
+                                             leaders->nodes[tree].left, loc);
+   }
+   else {
+      leaders->nodes[tree].right = insertNode(leaders,
+                                              leaders->nodes[tree].right, loc);
+   }
+   resize(leaders, tree);
+   return tree;
+}
+
+/* Function takes a player out of a subtree. Returns the root
+   of the subtree.
+*/
+int removeNode(Leaderboard *leaders, int tree, int loc) {
+   LeaderNode *node = &leaders->nodes[tree];
+
+   // Player's children take their place
+   if(tree == loc) { return mergeTrees(leaders, node->left, node->right); }
+   if(ranksBefore(leaders, loc, tree)) {
+      node->left = removeNode(leaders, node->left, loc);
+   }
+   else { node->right = removeNode(leaders, node->right, loc); }
+   resize(leaders, tree);
+   return tree;
+}
+
+/* Function splits a subtree into the players ranked before
+   player loc and those ranked after.
+*/
+void splitTree(Leaderboard *leaders, int tree, int loc, int *before,
+               int *after) {
+   // Subtree is empty
+   if(tree == -1) {
+      *before = -1;
+      *after = -1;
+   }
+   else if(ranksBefore(leaders, tree, loc)) {
+      splitTree(leaders, leaders->nodes[tree].right, loc,
+                &leaders->nodes[tree].right, after);
+      resize(leaders, tree);
+      *before = tree;
+   }
+   else {
+      splitTree(leaders, leaders->nodes[tree].left, loc, before,
+                &leaders->nodes[tree].left);
+      resize(leaders, tree);
+      *after = tree;
+   }
+}
+
+/* Function joins two subtrees where every player in before
+   is ranked above every player in after. Returns the root
+   of the joined subtree.
+*/
+int mergeTrees(Leaderboard *leaders, int before, int after) {
+   // One side is empty
+   if(before == -1) { return after; }
+   if(after == -1) { return before; }
+   if(leaders->nodes[before].priority > leaders->nodes[after].priority) {
+      leaders->nodes[before].right = mergeTrees(leaders,
+                                                leaders->nodes[before].right,
+                                                after);
+      resize(leaders, before);
+      return before;
+   }
+   leaders->nodes[after].left = mergeTrees(leaders, before,
+                                           leaders->nodes[after].left);
+   resize(leaders, after);
+   return after;
+}
+
+/* Function gives the number of players in a subtree.
+*/
+int treeSize(Leaderboard *leaders, int tree) {
+   return tree == -1 ? 0 : leaders->nodes[tree].size;
+}
+
+/* Function counts the players in a subtree from the counts
+   of its children.
+*/
+void resize(Leaderboard *leaders, int tree) {
+   LeaderNode *node = &leaders->nodes[tree];
+   node->size = treeSize(leaders, node->left)
+                + treeSize(leaders, node->right) + 1;
+}
@@ -0,0 +1,42 @@
+/*
+This module ranks every player by score. Players are kept
+in a tree ordered by score, with the number of players
+under each node, so a player is moved, ranked, or found
+by rank in time that grows with the log of the number of
+players.
+*/
+
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include <pthread.h>
+#include "registry.h"
+
+// Gives the score a player is ranked by
+typedef int (*LeaderScore)(PlayerRecord *record);
+
+typedef struct LEADERNODE {
+   int score;           // Score the player was last placed with
+   int left;            // Players ranked above, -1 if none
+   int right;           // Players ranked below, -1 if none
+   int size;            // Players in the subtree
+   unsigned int priority; // Higher priorities are nearer the root
+   char placed;         // Player is in the tree
+}  LeaderNode;
+
+typedef struct LEADERBOARD {
+   Registry *scoreboard;
+   LeaderScore score;
+   LeaderNode *nodes;   // Node of each player, by location
+   int cap;
+   int root;            // -1 while no one is ranked
+   pthread_mutex_t lock;
+}  Leaderboard;
+
+Leaderboard *createLeaderboard(Registry *scoreboard, LeaderScore score);
+void rankPlayer(Leaderboard *leaders, int loc);
+int countRanked(Leaderboard *leaders);
+int playerRank(Leaderboard *leaders, int loc);
+int rankedPlayers(Leaderboard *leaders, int first, int count, int *locs);
+
+#endif
@@ -0,0 +1,541 @@
+/*
+Compile: gcc -O2 -o loadgen loadgen.c reactor.c wire.c board.c -lpthread
+Run:     ./loadgen [-p players] [-t threads] [-d seconds] [-b] host port
+
+This program loads the server with many simulated players
+at once (-p) and reports how it held up. The players are
+spread over event loops on several threads (-t), each
+player a state machine advanced whenever the server sends
+it data, the same way the server hosts them. Every player
+logs in, plays a game against whoever it is paired with,
+or the computer (-b), taking a random free cell each turn,
+and logs in again for the next game until time is up
+(-d). Players still in a game then finish it. The report
+gives games a second, how long logins took from connecting
+to being accepted, and how long each move took from being
+sent to the board coming back, at several percentiles.
+Names are load1, load2, and so on, so repeated runs log in
+the same players.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <netdb.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include "reactor.h"
+#include "wire.h"
+#include "board.h"
+
+#define LOGIN 'L'
+#define CHAT 'C'
+#define MOVE 'M'
+#define COMPUTER "bot"
+#define TICK_MS 100      // Milliseconds between checks of the clock
+#define DRAIN_SECONDS 5  // Longest games in play are waited for once time is up
+
+enum LOADSTATE {
+   CONNECTING,          // Waiting for the connection to be made
+   AWAIT_ACCEPT,        // Waiting for the login reply
+   AWAIT_TOKEN,         // Waiting for the token to resume with
+   AWAIT_START,         // Waiting in the lobby for number, size, and run
+   AWAIT_NAME_SIZE,     // Waiting for the size of a name
+   AWAIT_NAME,          // Waiting for a name
+   AWAIT_TAKEN,         // Waiting to hear if the move was taken
+   AWAIT_OPTION,        // Waiting for the opponent's chat option
+   AWAIT_CHAT_SIZE,     // Waiting for the size of the opponent's chat
+   AWAIT_CHAT,          // Waiting for the opponent's chat
+   AWAIT_STATUS,        // Waiting for the game status after a move
+   AWAIT_BOARD,         // Waiting for the board after a move
+   AWAIT_RECORDS,       // Waiting for both records once the game is over
+   IDLE                 // Between games, or done
+};
+
+typedef struct SAMPLES {
+   double *values;      // Milliseconds
+   int count;
+   int cap;
+}  Samples;
+
+typedef struct LOADTHREAD LoadThread;
+
+typedef struct LOADPLAYER {
+   LoadThread *thread;
+   Connection *conn;    // NULL while idle
+   int number;          // Name is load followed by it
+   int state;
+   char symbol;         // Symbol the player plays
+   char turn;           // Symbol of player whose turn it is
+   int over;            // 1 once the game's result arrived
+   int namesLeft;       // Names still to be received
+   int fieldSize;       // Size of the name or chat being received
+   Board board;
+   double started;      // When the login or move being timed began
+}  LoadPlayer;
+
+struct LOADTHREAD {
+   pthread_t id;
+   Reactor *reactor;
+   struct addrinfo *server;
+   LoadPlayer *players;
+   int count;
+   int active;          // Players with a connection
+   int computer;        // 1 if players play the computer
+   unsigned int seed;   // Seed of the moves chosen on this thread
+   double deadline;     // When players stop starting games
+   Samples logins;
+   Samples moves;
+   long games;
+   long failed;         // Logins refused and connections lost
+};
+
+void *runPlayers(void *arg);
+void startPlayer(LoadPlayer *player);
+void playerEvent(Connection *conn, int events);
+int advancePlayer(LoadPlayer *player);
+int fieldSize(LoadPlayer *player);
+void sendLogin(LoadPlayer *player);
+void startTurn(LoadPlayer *player);
+void sendMove(LoadPlayer *player);
+void finishGame(LoadPlayer *player);
+void dropPlayer(LoadPlayer *player);
+void checkClock(void *arg);
+void addSample(Samples *samples, double value);
+void mergeSamples(Samples *into, Samples *from);
+int compareSamples(const void *a, const void *b);
+void printSamples(char *label, Samples *samples);
+double clockMs(void);
+
+/* Main function which starts every thread's players, waits
+   for the time to run out and the games in play to finish,
+   and prints the report.
+*/
+int main(int argc, char *argv[]) {
+   struct addrinfo hints, *server;
+   LoadThread *threads;
+   int players = 100, count = 1, seconds = 10, computer = 0;
+   int option, i, j, first;
+   long games = 0, failed = 0;
+   double started, took;
+
+   // Read player, thread, time, and opponent options
+   while((option = getopt(argc, argv, "p:t:d:b")) != -1) {
+      if((option == 'p' && (players = atoi(optarg)) < 1)
+         || (option == 't' && (count = atoi(optarg)) < 1)
+         || (option == 'd' && (seconds = atoi(optarg)) < 1)) {
+         printf("Players, threads, and seconds must be at least 1\n");
+         exit(1);
+      }
+      else if(option == 'b') { computer = 1; }
+      else if(option == '?') { exit(1); }
+   }
+   // Program was run without host and port
+   if(optind != argc - 2) {
+      printf("No server host and port\n");
+      exit(1);
+   }
+   memset(&hints, 0, sizeof(hints));
+   hints.ai_family = AF_UNSPEC;
+   hints.ai_socktype = SOCK_STREAM;
+   // Server's address could not be found
+   if(getaddrinfo(argv[optind], argv[optind + 1], &hints, &server) != 0) {
+      printf("Unknown server\n");
+      exit(1);
+   }
+   if(count > players) { count = players; }
+
+   threads = (LoadThread*)calloc(count, sizeof(LoadThread));
+   started = clockMs();
+   for(i = 0, first = 0; i < count; i++) {
+      threads[i].reactor = createReactor();
+      threads[i].server = server;
+      threads[i].count = players / count + (i < players % count ? 1 : 0);
+      threads[i].players = (LoadPlayer*)calloc(threads[i].count,
+                                               sizeof(LoadPlayer));
+      threads[i].computer = computer;
+      threads[i].seed = i + 1;
+      threads[i].deadline = started + seconds * 1000.0;
+      for(j = 0; j < threads[i].count; j++) {
+         threads[i].players[j].thread = &threads[i];
+         threads[i].players[j].number = ++first;
+      }
+      pthread_create(&threads[i].id, NULL, runPlayers, &threads[i]);
+   }
+   for(i = 0; i < count; i++) {
+      pthread_join(threads[i].id, NULL);
+      games += threads[i].games;
+      failed += threads[i].failed;
+      if(i > 0) {
+         mergeSamples(&threads[0].logins, &threads[i].logins);
+         mergeSamples(&threads[0].moves, &threads[i].moves);
+      }
+   }
+   took = (clockMs() - started) / 1000.0;
+
+   printf("%d players on %d threads for %.1f s against %s\n", players, count,
+          took, computer ? "the computer" : "each other");
+   printf("%ld games, %.1f games/s, %ld logins failed or connections lost\n",
+          games, games / took, failed);
+   printSamples("Login", &threads[0].logins);
+   printSamples("Move round trip", &threads[0].moves);
+   freeaddrinfo(server);
+}
+
+/* Thread function connects every player of the thread and
+   runs their event loop until they are all done.
+*/
+void *runPlayers(void *arg) {
+   LoadThread *thread = (LoadThread*) arg;
+   int i;
+
+   setBatchHook(thread->reactor, checkClock, thread, TICK_MS);
+   for(i = 0; i < thread->count; i++) { startPlayer(&thread->players[i]); }
+   runReactor(thread->reactor);
+   return NULL;
+}
+
+/* Function starts connecting a player to the server without
+   waiting for the connection to be made. The login goes out
+   once the socket is writable.
+*/
+void startPlayer(LoadPlayer *player) {
+   LoadThread *thread = player->thread;
+   int fd = socket(thread->server->ai_family, SOCK_STREAM, 0);
+
+   player->started = clockMs();
+   player->state = CONNECTING;
+   player->conn = addConnection(thread->reactor, fd, playerEvent, player);
+   // Socket could not be watched
+   if(player->conn == NULL) {
+      close(fd);
+      thread->failed++;
+      player->state = IDLE;
+      return;
+   }
+   thread->active++;
+   // Connection was refused right away
+   if(connect(fd, thread->server->ai_addr, thread->server->ai_addrlen) == -1
+      && errno != EINPROGRESS) {
+      dropPlayer(player);
+      return;
+   }
+   watchOutput(player->conn, 1);
+}
+
+/* Event handler called when a player's connection was made
+   or the server sent it data. Advances the player as far as
+   the data received so far allows.
+*/
+void playerEvent(Connection *conn, int events) {
+   LoadPlayer *player = (LoadPlayer*) conn->owner;
+   int error = 0, status;
+   socklen_t size = sizeof(error);
+
+   if(player->state == CONNECTING) {
+      getsockopt(conn->fd, SOL_SOCKET, SO_ERROR, &error, &size);
+      // Connection could not be made
+      if(error != 0) {
+         dropPlayer(player);
+         return;
+      }
+      watchOutput(conn, 0);
+      watchInput(conn, 1);
+      sendLogin(player);
+      return;
+   }
+   // Keep advancing until more input is needed or the game is over
+   while((status = advancePlayer(player)) == 1) {}
+   // Server closed the connection or sent what no player expects
+   if(status == -1) { dropPlayer(player); }
+}
+
+/* Function advances a player by one field from the server.
+   Returns 1 if the player advanced, 0 if more input is
+   needed, 2 once the game is over, and -1 on error.
+*/
+int advancePlayer(LoadPlayer *player) {
+   int words = (player->board.size * player->board.size + 31) / 32;
+   char field[2 * BOARD_WORDS * sizeof(int)];
+   int got, size, i, value = 0;
+
+   // Fields of no size are taken at once
+   if((size = fieldSize(player)) > 0) {
+      got = recvField(player->conn, field, size);
+      if(got <= 0) { return got; }
+   }
+   if(size >= (int) sizeof(int)) { value = getInt(field); }
+
+   switch(player->state) {
+   case AWAIT_ACCEPT:
+      // Login was refused
+      if(value != 0) { return -1; }
+      addSample(&player->thread->logins, clockMs() - player->started);
+      player->state = AWAIT_TOKEN;
+      return 1;
+   case AWAIT_TOKEN:
+      player->state = AWAIT_START;
+      return 1;
+   case AWAIT_START:
+      // Server plays a board no player can hold
+      if(getInt(field + sizeof(int)) < 3
+         || getInt(field + sizeof(int)) > MAX_SIDE) {
+         return -1;
+      }
+      initBoard(&player->board, getInt(field + sizeof(int)),
+                getInt(field + 2 * sizeof(int)));
+      player->symbol = value == 1 ? PLAYER1 : PLAYER2;
+      player->turn = PLAYER1;
+      player->over = 0;
+      player->namesLeft = 2;
+      player->state = AWAIT_NAME_SIZE;
+      return 1;
+   case AWAIT_NAME_SIZE:
+      // Name larger than a record holds
+      if(value < 1 || value > 21) { return -1; }
+      player->fieldSize = value;
+      player->state = AWAIT_NAME;
+      return 1;
+   case AWAIT_NAME:
+      // Both names arrived, before the first turn or after the last
+      if(--player->namesLeft > 0) { player->state = AWAIT_NAME_SIZE; }
+      else if(player->over) { player->state = AWAIT_RECORDS; }
+      else { startTurn(player); }
+      return 1;
+   case AWAIT_TAKEN:
+      // Cell was taken after all, choose another
+      if(value != 1) {
+         sendMove(player);
+         return 1;
+      }
+      player->state = AWAIT_STATUS;
+      return 1;
+   case AWAIT_OPTION:
+      player->state = field[0] == CHAT ? AWAIT_CHAT_SIZE : AWAIT_STATUS;
+      return 1;
+   case AWAIT_CHAT_SIZE:
+      // Chat larger than the server allows
+      if(value < 0 || value > 200) { return -1; }
+      player->fieldSize = value;
+      player->state = value > 0 ? AWAIT_CHAT : AWAIT_STATUS;
+      return 1;
+   case AWAIT_CHAT:
+      player->state = AWAIT_STATUS;
+      return 1;
+   case AWAIT_STATUS:
+      player->over = value != -1;
+      player->state = AWAIT_BOARD;
+      return 1;
+   case AWAIT_BOARD:
+      for(i = 0; i < words; i++) {
+         player->board.x[i] = getInt(field + i * sizeof(int));
+         player->board.o[i] = getInt(field + (words + i) * sizeof(int));
+      }
+      // Player's own move came back
+      if(player->turn == player->symbol) {
+         addSample(&player->thread->moves, clockMs() - player->started);
+      }
+      // Names and records follow the last board
+      if(player->over) {
+         player->namesLeft = 2;
+         player->state = AWAIT_NAME_SIZE;
+         return 1;
+      }
+      player->turn = player->turn == PLAYER1 ? PLAYER2 : PLAYER1;
+      startTurn(player);
+      return 1;
+   case AWAIT_RECORDS:
+      finishGame(player);
+      return 2;
+   }
+   return -1;
+}
+
+/* Function gives the size of the field the player is
+   waiting for.
+*/
+int fieldSize(LoadPlayer *player) {
+   int words = (player->board.size * player->board.size + 31) / 32;
+
+   switch(player->state) {
+   case AWAIT_TOKEN: return 2 * sizeof(int);
+   case AWAIT_START: return 3 * sizeof(int);
+   case AWAIT_NAME:
+   case AWAIT_CHAT: return player->fieldSize;
+   case AWAIT_OPTION: return sizeof(char);
+   case AWAIT_BOARD: return 2 * words * sizeof(int);
+   case AWAIT_RECORDS: return 8 * sizeof(int);
+   }
+   return sizeof(int);
+}
+
+/* Function sends a player's login frame: its name and
+   password, and the computer or anyone as its opponent.
+*/
+void sendLogin(LoadPlayer *player) {
+   char name[21];
+   char *opponent = player->thread->computer ? COMPUTER : "";
+   Message frame;
+
+   snprintf(name, sizeof(name), "load%d", player->number);
+   initMessage(&frame);
+   putChar(&frame, LOGIN);
+   putInt(&frame, strlen(name) + 1);
+   putInt(&frame, strlen(name) + 1);
+   putInt(&frame, strlen(opponent) + 1);
+   putBytes(&frame, name, strlen(name) + 1);
+   putBytes(&frame, name, strlen(name) + 1);  // Password is the name
+   putBytes(&frame, opponent, strlen(opponent) + 1);
+   sendConn(player->conn, frame.data, frame.len);
+   player->state = AWAIT_ACCEPT;
+}
+
+/* Function starts the turn: the player moves on its own
+   turn and otherwise waits for the opponent's.
+*/
+void startTurn(LoadPlayer *player) {
+   if(player->turn == player->symbol) {
+      player->started = clockMs();
+      sendMove(player);
+   }
+   else { player->state = AWAIT_OPTION; }
+}
+
+/* Function sends a move to a random free cell, without a
+   chat. The chat option only goes with the first try.
+*/
+void sendMove(LoadPlayer *player) {
+   Board *board = &player->board;
+   int open[MAX_SIDE * MAX_SIDE];  // Cells not taken
+   int count = 0, cell;
+   Message frame;
+
+   for(cell = 0; cell < board->size * board->size; cell++) {
+      if(isTaken(board, cell / board->size, cell % board->size)) {
+         open[count++] = cell;
+      }
+   }
+   // Board is full, no move can be taken
+   if(count == 0) { open[count++] = 0; }
+   cell = open[rand_r(&player->thread->seed) % count];
+   markBoard(board, cell / board->size, cell % board->size, player->symbol);
+   initMessage(&frame);
+   if(player->state != AWAIT_TAKEN) { putChar(&frame, MOVE); }
+   putInt(&frame, cell / board->size);
+   putInt(&frame, cell % board->size);
+   sendConn(player->conn, frame.data, frame.len);
+   player->state = AWAIT_TAKEN;
+}
+
+/* Function counts a finished game, once for both players,
+   and logs the player in again for the next, unless time
+   is up.
+*/
+void finishGame(LoadPlayer *player) {
+   LoadThread *thread = player->thread;
+
+   // Player X counts the game, the computer never plays X
+   if(player->symbol == PLAYER1) { thread->games++; }
+   closeConnection(player->conn);
+   player->conn = NULL;
+   player->state = IDLE;
+   thread->active--;
+   if(clockMs() < thread->deadline) { startPlayer(player); }
+}
+
+/* Function closes a player whose login was refused or whose
+   connection was lost. It is not started again.
+*/
+void dropPlayer(LoadPlayer *player) {
+   player->thread->failed++;
+   closeConnection(player->conn);
+   player->conn = NULL;
+   player->state = IDLE;
+   player->thread->active--;
+}
+
+/* Batch hook which, once time is up, closes players not in
+   a game, and stops the event loop once every player is
+   done or the games in play took too long to finish.
+*/
+void checkClock(void *arg) {
+   LoadThread *thread = (LoadThread*) arg;
+   double now = clockMs();
+   LoadPlayer *player;
+   int i;
+
+   // Time is not up yet
+   if(now < thread->deadline) { return; }
+   for(i = 0; i < thread->count; i++) {
+      player = &thread->players[i];
+      // Player waiting to log in or be paired starts no game
+      if(player->conn != NULL
+         && (player->state <= AWAIT_START
+             || now >= thread->deadline + DRAIN_SECONDS * 1000.0)) {
+         closeConnection(player->conn);
+         player->conn = NULL;
+         player->state = IDLE;
+         thread->active--;
+      }
+   }
+   if(thread->active == 0) { stopReactor(thread->reactor); }
+}
+
+/* Function adds a sample, growing the samples by doubling.
+*/
+void addSample(Samples *samples, double value) {
+   if(samples->count == samples->cap) {
+      samples->cap = samples->cap == 0 ? 1024 : samples->cap * 2;
+      samples->values = (double*)realloc(samples->values,
+                                         samples->cap * sizeof(double));
+   }
+   samples->values[samples->count++] = value;
+}
+
+/* Function adds every sample of one thread to another's.
+*/
+void mergeSamples(Samples *into, Samples *from) {
+   int i;
+
+   for(i = 0; i < from->count; i++) { addSample(into, from->values[i]); }
+   free(from->values);
+}
+
+/* Function compares two samples so the smallest sorts first.
+*/
+int compareSamples(const void *a, const void *b) {
+   double first = *(double*) a, second = *(double*) b;
+
+   return first < second ? -1 : first > second ? 1 : 0;
+}
+
+/* Function prints how many samples there were and the
+   milliseconds they took at the median and upper percentiles.
+*/
+void printSamples(char *label, Samples *samples) {
+   double *values = samples->values;
+   int n = samples->count;
+
+   // Nothing was timed
+   if(n == 0) {
+      printf("%s: none\n", label);
+      return;
+   }
+   qsort(values, n, sizeof(double), compareSamples);
+   printf("%s ms over %d: p50 %.3f  p90 %.3f  p99 %.3f  p99.9 %.3f  "
+          "max %.3f\n", label, n, values[n / 2], values[n * 90 / 100],
+          values[n * 99 / 100], values[(long) n * 999 / 1000], values[n - 1]);
+}
+
+/* Function gets the time on the monotonic clock in
+   milliseconds.
+*/
+double clockMs(void) {
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return now.tv_sec * 1000.0 + now.tv_nsec / 1e6;
+}
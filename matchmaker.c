@@ -0,0 +1,201 @@
+/*
+This module is the matchmaking lobby. Players join the
+queue once logged in and leave it when paired or when
+they disconnect. A matching pass walks the queue in
+arrival order and asks the lobby's policy for a partner
+for each player still waiting, so a player that cannot
+be paired yet never holds up the players behind them.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "matchmaker.h"
+
+#define RATING_WINDOW 50   // Rating difference always accepted
+#define RATING_WIDEN 5     // Seconds of waiting that widen window by a step
+#define RATING_STEP 25     // Rating difference added to window each widening
+
+int canPair(LobbyEntry *player, LobbyEntry *partner);
+
+/* Function creates an empty lobby which pairs players by the
+   given policy and hands matches to dispatch.
+*/
+Lobby *createLobby(MatchPolicy policy, MatchDispatch dispatch, void *arg) {
+   Lobby *lobby = (Lobby*)calloc(1, sizeof(Lobby));
+   lobby->policy = policy;
+   lobby->dispatch = dispatch;
+   lobby->arg = arg;
+   return lobby;
+}
+
+/* Function finds the policy with the given name. Returns
+   NULL if there is no such policy.
+*/
+MatchPolicy findPolicy(char *name) {
+   if(strcmp(name, "fifo") == 0) { return fifoPolicy; }
+   if(strcmp(name, "rating") == 0) { return ratingPolicy; }
+   if(strcmp(name, "named") == 0) { return namedPolicy; }
+   return NULL;
+}
+
+/* Function adds a logged in player to the back of the queue.
+*/
+void joinLobby(Lobby *lobby, LobbyEntry *entry) {
+   // Grow queue when it is full
+   if(lobby->count == lobby->cap) {
+      lobby->cap = lobby->cap == 0 ? 16 : lobby->cap * 2;
+      lobby->entries = (LobbyEntry*)realloc(lobby->entries,
+                                            sizeof(LobbyEntry) * lobby->cap);
+   }
+   lobby->entries[lobby->count] = *entry;
+   lobby->entries[lobby->count].joined = time(NULL);
+   lobby->entries[lobby->count].matched = 0;
+   lobby->count++;
+   lobby->changed = 1;
+}
+
+/* Function removes a waiting player from the queue, keeping
+   the order of everyone behind them. Returns the seat of
+   the player, NULL if they were not waiting.
+*/
+void *leaveLobby(Lobby *lobby, void *player) {
+   void *seat;
+   int i;
+
+   for(i = 0; i < lobby->count; i++) {
+      // If this is the player who left
+      if(lobby->entries[i].player == player) {
+         seat = lobby->entries[i].seat;
+         memmove(&lobby->entries[i], &lobby->entries[i + 1],
+                 sizeof(LobbyEntry) * (lobby->count - i - 1));
+         lobby->count--;
+         return seat;
+      }
+   }
+   return NULL;
+}
+
+/* Function pairs as many waiting players as the policy allows
+   and dispatches all matches made in one batch. Players who
+   waited soloAfter seconds without a partner play the computer.
+   Passes only repeat without new players once a second, since
+   waiting longer is all that can change the outcome.
+*/
+void runMatching(Lobby *lobby) {
+   time_t now = time(NULL);
+   int waiting = lobby->soloAfter > 0; // Waiting alone ends in a game
+   Match *matches;
+   int made = 0, kept = 0, i, j;
+
+   // Nothing changed and nothing can change by waiting
+   if(lobby->count < (waiting ? 1 : 2) || (!lobby->changed
+      && ((lobby->policy == fifoPolicy && !waiting)
+          || now == lobby->lastPass))) {
+      return;
+   }
+   lobby->lastPass = now;
+   lobby->changed = 0;
+   matches = (Match*)malloc(sizeof(Match) * lobby->count);
+
+   // Earliest arrivals are paired first and move first
+   for(i = 0; i < lobby->count; i++) {
+      if(lobby->entries[i].matched) { continue; }
+      j = lobby->policy(lobby, i, now);
+      // No partner fits this player yet
+      if(j < 0) { continue; }
+      lobby->entries[i].matched = 1;
+      lobby->entries[j].matched = 1;
+      matches[made].x = lobby->entries[i < j ? i : j];
+      matches[made].o = lobby->entries[i < j ? j : i];
+      made++;
+   }
+   // Players left waiting too long play the computer
+   for(i = 0; i < lobby->count && waiting; i++) {
+      if(lobby->entries[i].matched
+         || now - lobby->entries[i].joined < lobby->soloAfter) {
+         continue;
+      }
+      lobby->entries[i].matched = 1;
+      matches[made].x = lobby->entries[i];
+      memset(&matches[made].o, 0, sizeof(LobbyEntry));
+      made++;
+   }
+   // Remove paired players from the queue
+   for(i = 0; i < lobby->count; i++) {
+      if(!lobby->entries[i].matched) {
+         lobby->entries[kept++] = lobby->entries[i];
+      }
+   }
+   lobby->count = kept;
+
+   // Hand all matches from this pass over together
+   if(made > 0) { lobby->dispatch(lobby->arg, matches, made); }
+   free(matches);
+}
+
+/* Function determines if two waiting players can play
+   each other.
+*/
+int canPair(LobbyEntry *player, LobbyEntry *partner) {
+   return player != partner && !partner->matched
+          && partner->loc != player->loc;
+}
+
+/* Policy pairs each player with the next player to arrive.
+*/
+int fifoPolicy(Lobby *lobby, int index, time_t now) {
+   int j;
+
+   for(j = index + 1; j < lobby->count; j++) {
+      if(canPair(&lobby->entries[index], &lobby->entries[j])) { return j; }
+   }
+   return -1;
+}
+
+/* Policy pairs each player with the closest rated player
+   within a window that widens the longer they have waited.
+*/
+int ratingPolicy(Lobby *lobby, int index, time_t now) {
+   LobbyEntry *player = &lobby->entries[index];
+   int window = RATING_WINDOW
+                + (now - player->joined) / RATING_WIDEN * RATING_STEP;
+   int best = -1, bestDiff = 0, diff, j;
+
+   for(j = 0; j < lobby->count; j++) {
+      if(!canPair(player, &lobby->entries[j])) { continue; }
+      diff = abs(lobby->entries[j].rating - player->rating);
+      // Closer than any partner found so far
+      if(diff <= window && (best == -1 || diff < bestDiff)) {
+         best = j;
+         bestDiff = diff;
+      }
+   }
+   return best;
+}
+
+/* Policy pairs players who requested each other, and players
+   who requested no one in arrival order. A request that has
+   waited too long is treated as a request for anyone.
+*/
+int namedPolicy(Lobby *lobby, int index, time_t now) {
+   LobbyEntry *player = &lobby->entries[index];
+   LobbyEntry *partner;
+   int anyone = player->opponent[0] == '\0'
+                || now - player->joined >= REQUEST_TIMEOUT;
+   int partnerAnyone, j;
+
+   for(j = 0; j < lobby->count; j++) {
+      partner = &lobby->entries[j];
+      if(!canPair(player, partner)) { continue; }
+      partnerAnyone = partner->opponent[0] == '\0'
+                      || now - partner->joined >= REQUEST_TIMEOUT;
+      // Each player either wants anyone or wants the other
+      if((anyone || strcmp(player->opponent, partner->name) == 0)
+         && (partnerAnyone || strcmp(partner->opponent, player->name) == 0)) {
+         return j;
+      }
+   }
+   return -1;
+}
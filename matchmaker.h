@@ -0,0 +1,58 @@
+/*
+This module is the matchmaking lobby. Logged in players
+wait in a queue until a matching pass pairs them by the
+lobby's policy, and the matches made in one pass are
+handed to the server together.
+*/
+
+#ifndef MATCHMAKER_H
+#define MATCHMAKER_H
+
+#include <time.h>
+
+#define REQUEST_TIMEOUT 30 // Seconds a requested opponent is waited for
+
+typedef struct LOBBY Lobby;
+
+typedef struct LOBBYENTRY {
+   void *player;        // Connection of the waiting player
+   int loc;             // Location of player on scoreboard
+   void *seat;          // Seat the player resumes from, NULL for the computer
+   int rating;
+   char name[21];
+   char opponent[21];   // Name of requested opponent, empty for anyone
+   time_t joined;
+   int matched;         // 1 once paired during the current pass
+}  LobbyEntry;
+
+typedef struct MATCH {
+   LobbyEntry x;        // Player who moves first
+   LobbyEntry o;        // Player NULL if x plays the computer
+}  Match;
+
+// Returns index of partner for entry at index or -1 if none fits yet
+typedef int (*MatchPolicy)(Lobby *lobby, int index, time_t now);
+typedef void (*MatchDispatch)(void *arg, Match *matches, int count);
+
+struct LOBBY {
+   LobbyEntry *entries; // Waiting players in arrival order
+   int count;
+   int cap;
+   int changed;         // 1 if players joined since the last pass
+   time_t lastPass;     // Time of the last matching pass
+   int soloAfter;       // Seconds before a player plays the computer, 0 never
+   MatchPolicy policy;
+   MatchDispatch dispatch;
+   void *arg;           // Passed to dispatch
+};
+
+Lobby *createLobby(MatchPolicy policy, MatchDispatch dispatch, void *arg);
+MatchPolicy findPolicy(char *name);
+void joinLobby(Lobby *lobby, LobbyEntry *entry);
+void *leaveLobby(Lobby *lobby, void *player);
+void runMatching(Lobby *lobby);
+int fifoPolicy(Lobby *lobby, int index, time_t now);
+int ratingPolicy(Lobby *lobby, int index, time_t now);
+int namedPolicy(Lobby *lobby, int index, time_t now);
+
+#endif
@@ -0,0 +1,1654 @@
+/*
+Generated by gentable, do not edit. Holds the value and
+best move of each of the 5478 positions of the 3 x 3
+game that can be reached, at the board's base 3 index.
+*/
+
+#ifndef PERFECT_TABLE_H
+#define PERFECT_TABLE_H
+
+static const unsigned char PERFECT[19683] = {
+   0x10, 0x14, 0xff, 0x10, 0xff, 0x13, 0xff, 0x23, 0xff, 0x14, 0xff, 0x25,
+   0xff, 0xff, 0x23, 0x24, 0x14, 0xff, 0xff, 0x23, 0xff, 0x14, 0x25, 0xff,
+   0xff, 0xff, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x14, 0x20, 0x06, 0xff,
+   0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0x14, 0xff, 0x24, 0x20, 0x06, 0xff,
+   0x28, 0xff, 0x24, 0xff, 0x26, 0xff, 0xff, 0x21, 0xff, 0x20, 0x02, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x20, 0xff, 0x06, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x17, 0x20, 0x08, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff,
+   0x06, 0xff, 0x26, 0x10, 0x18, 0xff, 0x17, 0xff, 0x27, 0xff, 0x28, 0xff,
+   0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x05, 0xff, 0x25, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x15, 0xff, 0x25, 0xff, 0xff, 0x05,
+   0x25, 0x05, 0xff, 0x20, 0x08, 0xff, 0x07, 0xff, 0x27, 0xff, 0x28, 0xff,
+   0x06, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x05, 0xff, 0xff, 0x28, 0xff,
+   0x27, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x10, 0x12, 0xff,
+   0xff, 0xff, 0xff, 0x10, 0x11, 0xff, 0x10, 0xff, 0x18, 0xff, 0x17, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0x10, 0x16, 0xff,
+   0x10, 0xff, 0x18, 0xff, 0x26, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff, 0x28,
+   0x17, 0x27, 0xff, 0xff, 0x26, 0xff, 0x16, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x12, 0xff, 0x22, 0xff, 0xff, 0x26, 0x22, 0x14, 0xff,
+   0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x08, 0xff, 0x28, 0x10, 0x13, 0xff,
+   0x13, 0xff, 0x24, 0xff, 0x23, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04,
+   0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x04, 0xff, 0x10, 0x12, 0xff,
+   0x12, 0xff, 0x26, 0xff, 0x28, 0xff, 0x18, 0xff, 0x28, 0xff, 0xff, 0x26,
+   0x28, 0x18, 0xff, 0xff, 0x11, 0xff, 0x10, 0x14, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x03, 0xff, 0x23, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x13, 0xff, 0x23, 0xff, 0xff, 0x03,
+   0x23, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x10, 0xff, 0x16, 0xff, 0xff, 0x26,
+   0x22, 0x18, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x00, 0xff, 0x26,
+   0x10, 0x18, 0xff, 0x17, 0xff, 0x27, 0xff, 0x28, 0xff, 0x10, 0x11, 0xff,
+   0x10, 0xff, 0x18, 0xff, 0x17, 0xff, 0x18, 0xff, 0x28, 0xff, 0xff, 0x28,
+   0x28, 0x27, 0xff, 0xff, 0x16, 0xff, 0x16, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x08, 0xff, 0xff, 0x28, 0x07, 0x27, 0xff, 0xff, 0xff, 0x28,
+   0xff, 0xff, 0xff, 0x27, 0xff, 0x28, 0x06, 0x26, 0xff, 0x26, 0xff, 0x06,
+   0xff, 0x26, 0xff, 0xff, 0x22, 0xff, 0x22, 0x12, 0xff, 0xff, 0xff, 0xff,
+   0x28, 0x01, 0xff, 0x00, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x00, 0xff, 0x24, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0xff, 0x10, 0x16, 0xff,
+   0x10, 0xff, 0x12, 0xff, 0x26, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x14,
+   0x26, 0x16, 0xff, 0xff, 0x26, 0xff, 0x28, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x08, 0xff, 0x07, 0xff, 0x27, 0xff, 0x28, 0xff,
+   0x06, 0xff, 0x26, 0xff, 0xff, 0x03, 0x26, 0x03, 0xff, 0xff, 0x28, 0xff,
+   0x27, 0x28, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x17,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0x16, 0xff, 0x26,
+   0x18, 0x28, 0xff, 0x28, 0xff, 0x27, 0xff, 0x26, 0xff, 0xff, 0x28, 0xff,
+   0x27, 0x02, 0xff, 0xff, 0xff, 0xff, 0x26, 0x01, 0xff, 0x00, 0xff, 0x26,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x20, 0x02, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x01, 0xff, 0x10, 0xff, 0x18, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0x22,
+   0xff, 0xff, 0x14, 0x20, 0x03, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff,
+   0x14, 0xff, 0x24, 0x20, 0x03, 0xff, 0x14, 0xff, 0x27, 0xff, 0x23, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x02, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x20, 0xff, 0x01, 0xff, 0xff, 0x28,
+   0x20, 0x0f, 0xff, 0x24, 0x14, 0xff, 0x14, 0xff, 0x24, 0xff, 0x24, 0xff,
+   0x14, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff, 0x28, 0xff,
+   0x27, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff,
+   0x02, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0x10, 0xff, 0x11, 0xff, 0xff, 0x17, 0x20, 0x03, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0x02, 0xff, 0x22, 0xff, 0xff, 0x02, 0x22, 0x02, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x27, 0x18, 0xff, 0x17, 0xff, 0x27,
+   0xff, 0x28, 0xff, 0x10, 0x13, 0xff, 0x10, 0xff, 0x18, 0xff, 0x23, 0xff,
+   0x11, 0xff, 0x28, 0xff, 0xff, 0x28, 0x17, 0x27, 0xff, 0xff, 0x23, 0xff,
+   0x10, 0x13, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff, 0x28,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x27, 0xff, 0x05,
+   0x20, 0x0f, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff,
+   0x15, 0x25, 0xff, 0xff, 0xff, 0xff, 0x15, 0x25, 0xff, 0x25, 0xff, 0x05,
+   0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0x14, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x10, 0xff, 0x11, 0xff, 0xff, 0x14,
+   0x20, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x12, 0xff, 0x22, 0xff, 0xff, 0x02,
+   0x22, 0x14, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24,
+   0x10, 0x14, 0xff, 0x14, 0xff, 0x27, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0x12, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x17, 0x10, 0x18, 0xff, 0x11, 0xff, 0x28, 0xff, 0xff, 0x28,
+   0x17, 0x27, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x27, 0xff, 0x28,
+   0x10, 0x13, 0xff, 0x10, 0xff, 0x18, 0xff, 0x23, 0xff, 0xff, 0xff, 0x28,
+   0xff, 0xff, 0xff, 0x27, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x27, 0x20, 0xff, 0x01, 0xff, 0xff, 0x28, 0x20, 0x0f, 0xff,
+   0x28, 0x11, 0xff, 0x12, 0xff, 0x28, 0xff, 0x17, 0xff, 0x18, 0xff, 0x28,
+   0xff, 0xff, 0x28, 0x28, 0x27, 0xff, 0xff, 0x11, 0xff, 0x10, 0x17, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x03, 0xff, 0x14, 0xff, 0x24, 0xff, 0x23, 0xff,
+   0x14, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x03, 0xff, 0xff, 0x23, 0xff,
+   0x28, 0x28, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0x28,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24,
+   0x20, 0x0f, 0xff, 0x28, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff,
+   0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff,
+   0x02, 0xff, 0x22, 0xff, 0xff, 0x02, 0x22, 0x02, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x28, 0x28, 0xff, 0x28, 0xff, 0x27,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x28, 0xff, 0x01,
+   0xff, 0xff, 0x28, 0x20, 0x0f, 0xff, 0x22, 0x01, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0x28, 0xff, 0x27, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff,
+   0x13, 0x23, 0xff, 0xff, 0xff, 0xff, 0x13, 0x23, 0xff, 0x23, 0xff, 0x03,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff, 0xff, 0x10, 0xff, 0x18,
+   0xff, 0xff, 0x28, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x02, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x20, 0xff, 0x03, 0xff, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x12, 0x27, 0xff,
+   0x28, 0xff, 0x24, 0xff, 0x24, 0xff, 0x14, 0xff, 0x25, 0xff, 0xff, 0x28,
+   0x25, 0x27, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x10, 0x18, 0xff, 0x17, 0xff, 0x27, 0xff, 0x28, 0xff,
+   0x10, 0xff, 0x13, 0xff, 0xff, 0x23, 0x25, 0x18, 0xff, 0xff, 0x28, 0xff,
+   0x27, 0x03, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0x25, 0xff, 0xff, 0x02,
+   0x25, 0x02, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x15, 0xff, 0x25,
+   0x25, 0x01, 0xff, 0x00, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x28, 0xff,
+   0x27, 0x02, 0xff, 0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x12, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0x10, 0x11, 0xff, 0x10, 0xff, 0x18, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x18, 0xff,
+   0x20, 0xff, 0x03, 0xff, 0x24, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0x23,
+   0x28, 0x18, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0xff, 0x22, 0xff, 0x20, 0x02, 0xff, 0xff, 0xff, 0xff,
+   0x28, 0x01, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x23, 0xff, 0xff, 0x23,
+   0x23, 0x02, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x00, 0xff, 0x23,
+   0x23, 0x01, 0xff, 0x00, 0xff, 0x23, 0xff, 0x23, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0x10, 0x18, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x28, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x28, 0x18, 0xff, 0xff, 0x28, 0xff, 0x27, 0x07, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0x28, 0x01, 0xff, 0x00, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x02, 0x22, 0xff, 0x22, 0xff, 0x02,
+   0xff, 0x02, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x28, 0x27, 0xff,
+   0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x12, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0x10, 0x11, 0xff, 0x10, 0xff, 0x14, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff,
+   0x27, 0x02, 0xff, 0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x00, 0xff, 0x27,
+   0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff,
+   0x11, 0x28, 0xff, 0x17, 0xff, 0x27, 0xff, 0x28, 0xff, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x17, 0x10, 0x18, 0xff, 0xff, 0x28, 0xff, 0x27, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x11, 0xff, 0x26, 0xff, 0xff, 0x24, 0x10, 0x16, 0xff,
+   0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0x16, 0xff, 0x26, 0x28, 0x18, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0x26, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0x16, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04,
+   0x20, 0xff, 0x01, 0xff, 0xff, 0x24, 0x20, 0x06, 0xff, 0x24, 0x14, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0x28, 0xff, 0x14, 0xff, 0x26, 0xff, 0xff, 0x26,
+   0x26, 0x14, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x11, 0xff, 0x21, 0xff, 0xff, 0x0f,
+   0x10, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x01, 0xff, 0x21, 0xff, 0xff, 0x0f,
+   0x26, 0x18, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x16, 0xff, 0x26,
+   0x21, 0x01, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0x10, 0x13, 0xff,
+   0x20, 0xff, 0x08, 0xff, 0x26, 0xff, 0x13, 0xff, 0x28, 0xff, 0xff, 0x28,
+   0x28, 0x13, 0xff, 0xff, 0x26, 0xff, 0x06, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0x10, 0xff, 0x18, 0xff, 0xff, 0x28, 0x26, 0x16, 0xff, 0xff, 0xff, 0x28,
+   0xff, 0xff, 0xff, 0x16, 0xff, 0x28, 0x26, 0x26, 0xff, 0x26, 0xff, 0x05,
+   0xff, 0x26, 0xff, 0xff, 0x15, 0xff, 0x05, 0x25, 0xff, 0xff, 0xff, 0xff,
+   0x15, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0x16, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x08,
+   0x20, 0xff, 0x01, 0xff, 0xff, 0x24, 0x20, 0x03, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0x12, 0xff, 0x26, 0xff, 0xff, 0x26, 0x28, 0x18, 0xff, 0xff, 0xff, 0x26,
+   0xff, 0xff, 0xff, 0x18, 0xff, 0x28, 0x10, 0x14, 0xff, 0x14, 0xff, 0x24,
+   0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x26, 0x11, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x10, 0x18, 0xff,
+   0x12, 0xff, 0x28, 0xff, 0xff, 0x28, 0x28, 0x16, 0xff, 0xff, 0xff, 0x28,
+   0xff, 0xff, 0xff, 0x18, 0xff, 0x28, 0x16, 0x26, 0xff, 0x26, 0xff, 0x03,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x20, 0xff, 0x02,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xff, 0x01,
+   0xff, 0xff, 0x26, 0x00, 0x26, 0xff, 0x28, 0x12, 0xff, 0x20, 0xff, 0x02,
+   0xff, 0x28, 0xff, 0x18, 0xff, 0x28, 0xff, 0xff, 0x26, 0x28, 0x18, 0xff,
+   0xff, 0x16, 0xff, 0x16, 0x26, 0xff, 0xff, 0xff, 0xff, 0x24, 0x14, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0x26, 0xff, 0x14, 0xff, 0x24, 0xff, 0xff, 0x24,
+   0x26, 0x14, 0xff, 0xff, 0x28, 0xff, 0x24, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0x10, 0xff, 0x11, 0xff, 0xff, 0x14, 0x26, 0x16, 0xff, 0xff, 0xff, 0x14,
+   0xff, 0xff, 0xff, 0x16, 0xff, 0x26, 0x28, 0x28, 0xff, 0x28, 0xff, 0x24,
+   0xff, 0x26, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x21, 0xff, 0xff, 0x0f,
+   0x26, 0x18, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x16, 0xff, 0x26,
+   0x21, 0x28, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x11,
+   0xff, 0xff, 0xff, 0x22, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x16, 0x28, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x00, 0x28, 0xff,
+   0x21, 0x01, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x26, 0x06, 0xff, 0xff, 0x21, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x03, 0x23, 0xff, 0xff, 0xff, 0xff,
+   0x13, 0x23, 0xff, 0x23, 0xff, 0x03, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x26, 0x16, 0xff, 0x22, 0xff, 0x18,
+   0xff, 0x26, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff, 0x28, 0x26, 0x16, 0xff,
+   0xff, 0x26, 0xff, 0x00, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x18, 0xff, 0x28, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x28, 0xff, 0x28, 0xff, 0xff, 0x03,
+   0x28, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x08, 0xff, 0x28, 0xff, 0xff, 0x02,
+   0x28, 0x18, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24,
+   0x28, 0x18, 0xff, 0x00, 0xff, 0x24, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x28, 0x18, 0xff, 0x18, 0xff, 0x28, 0xff, 0xff, 0x28,
+   0x28, 0x02, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x18, 0xff, 0x28,
+   0x28, 0x01, 0xff, 0x28, 0xff, 0x28, 0xff, 0x23, 0xff, 0xff, 0xff, 0x28,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x28, 0x00, 0xff, 0x28, 0xff, 0xff, 0x28, 0x20, 0x0f, 0xff,
+   0x28, 0x25, 0xff, 0x25, 0xff, 0x28, 0xff, 0x28, 0xff, 0x25, 0xff, 0x28,
+   0xff, 0xff, 0x25, 0x28, 0x25, 0xff, 0xff, 0x28, 0xff, 0x28, 0x25, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x08,
+   0xff, 0xff, 0xff, 0x18, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x04, 0x18, 0xff, 0x28, 0xff, 0xff, 0x04, 0x28, 0x18, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x28,
+   0xff, 0xff, 0xff, 0x18, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x28, 0x18, 0xff, 0x28, 0xff, 0xff, 0x28, 0x28, 0x03, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0x18, 0xff, 0x28, 0xff, 0xff, 0x28, 0x28, 0x18, 0xff,
+   0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x18, 0xff, 0x28, 0x28, 0x18, 0xff,
+   0x18, 0xff, 0x28, 0xff, 0x28, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0x02,
+   0x28, 0x02, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24,
+   0x28, 0x28, 0xff, 0x28, 0xff, 0x24, 0xff, 0x23, 0xff, 0xff, 0xff, 0x28,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x04, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x20, 0x0f, 0xff,
+   0x28, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x28, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff, 0x28, 0xff, 0x24, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x28, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x28, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x22, 0x02, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x21, 0x28, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff,
+   0x28, 0x23, 0xff, 0x23, 0xff, 0x28, 0xff, 0x23, 0xff, 0x23, 0xff, 0x28,
+   0xff, 0xff, 0x23, 0x28, 0x23, 0xff, 0xff, 0x23, 0xff, 0x28, 0x23, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x28, 0xff, 0xff, 0x28, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0x28, 0x20, 0x0f, 0xff,
+   0x28, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x11, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0x12, 0xff, 0x10, 0xff, 0x13, 0xff, 0xff, 0x23,
+   0x10, 0x14, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0x11, 0xff, 0x24, 0xff, 0xff, 0x24, 0x10, 0x14, 0xff, 0xff, 0xff, 0x14,
+   0xff, 0xff, 0xff, 0x14, 0xff, 0x25, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0xff, 0x21, 0xff, 0x24, 0x02, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x01, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x21, 0xff, 0xff, 0x0f,
+   0x10, 0x18, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x10, 0xff, 0x13,
+   0x21, 0x01, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x15, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x15, 0x00, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x25, 0x05, 0xff,
+   0x21, 0x01, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x10, 0x18, 0xff, 0xff, 0x21, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x02, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0x10, 0x11, 0xff, 0x20, 0xff, 0x03, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x12, 0x22, 0xff, 0x22, 0xff, 0x02,
+   0xff, 0x12, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff, 0x28, 0x10, 0x15, 0xff,
+   0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x03, 0xff, 0xff, 0x23, 0x10, 0x14, 0xff, 0xff, 0xff, 0x23,
+   0xff, 0xff, 0xff, 0x18, 0xff, 0x28, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x14, 0xff, 0x24,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x24, 0xff, 0x24,
+   0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0x20, 0x01, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0x28, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0x18, 0xff,
+   0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23,
+   0xff, 0xff, 0xff, 0x13, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x23, 0x00, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x23, 0x03, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0x18, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x21, 0x01, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0x12, 0x22, 0xff, 0x22, 0xff, 0x02,
+   0xff, 0x12, 0xff, 0x18, 0xff, 0x28, 0xff, 0xff, 0x23, 0x28, 0x18, 0xff,
+   0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x01,
+   0xff, 0xff, 0x22, 0x12, 0x22, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff,
+   0x18, 0xff, 0x28, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0x22, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x28, 0x01, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x24, 0x02, 0xff, 0xff, 0xff, 0xff,
+   0x21, 0x11, 0xff, 0x00, 0xff, 0x24, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x11, 0x22, 0xff, 0x14, 0xff, 0x24,
+   0xff, 0x12, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x14, 0x10, 0x14, 0xff,
+   0xff, 0x01, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x21, 0x01, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0x11, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x10, 0x18, 0xff, 0xff, 0x21, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x11, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x10, 0x18, 0xff,
+   0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x10, 0xff, 0x18, 0x21, 0x28, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0x21, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x21, 0x01, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x12, 0xff, 0x12, 0x22, 0xff, 0xff, 0xff, 0xff, 0x10, 0x11, 0xff,
+   0x10, 0xff, 0x18, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x10, 0x12, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x10, 0xff, 0x16, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0x24, 0x26, 0xff,
+   0x10, 0xff, 0x14, 0xff, 0x26, 0xff, 0x14, 0xff, 0x24, 0xff, 0xff, 0x28,
+   0x24, 0x24, 0xff, 0xff, 0x26, 0xff, 0x14, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x08, 0xff, 0x10, 0xff, 0x13, 0xff, 0x28, 0xff,
+   0x06, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x03, 0xff, 0xff, 0x28, 0xff,
+   0x13, 0x28, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0x25, 0xff, 0xff, 0x15,
+   0x25, 0x02, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x25,
+   0x25, 0x01, 0xff, 0x15, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x28, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x26, 0x01, 0xff, 0x00, 0xff, 0x26,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x20, 0x02, 0xff, 0xff, 0xff, 0xff,
+   0x11, 0x21, 0xff, 0x10, 0xff, 0x18, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x14, 0xff,
+   0x10, 0xff, 0x13, 0xff, 0x24, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28,
+   0x28, 0x24, 0xff, 0xff, 0x23, 0xff, 0x13, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0xff, 0x14, 0x24, 0x24, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0x01, 0xff, 0x14, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0xff, 0x22, 0xff, 0x22, 0x12, 0xff, 0xff, 0xff, 0xff,
+   0x28, 0x01, 0xff, 0x00, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x23, 0xff, 0xff, 0x13,
+   0x23, 0x02, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x23,
+   0x23, 0x01, 0xff, 0x13, 0xff, 0x23, 0xff, 0x23, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0x22, 0x18, 0xff, 0x26, 0xff, 0x16, 0xff, 0x28, 0xff, 0x00, 0xff, 0x26,
+   0xff, 0xff, 0x26, 0x26, 0x06, 0xff, 0xff, 0x28, 0xff, 0x10, 0x18, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x22, 0x12, 0xff, 0xff, 0xff, 0xff,
+   0x28, 0x21, 0xff, 0x00, 0xff, 0x28, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0x01, 0x21, 0xff, 0x26, 0xff, 0x18,
+   0xff, 0x0f, 0xff, 0x21, 0xff, 0x28, 0xff, 0xff, 0x28, 0x0f, 0xff, 0xff,
+   0xff, 0x26, 0xff, 0x16, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x20, 0x02, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x01, 0xff, 0x10, 0xff, 0x14, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x26, 0x01, 0xff, 0x00, 0xff, 0x26,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x01, 0xff, 0x28, 0xff, 0x12, 0xff, 0x26, 0xff, 0x16, 0xff, 0x26,
+   0xff, 0xff, 0x16, 0x26, 0x06, 0xff, 0xff, 0x26, 0xff, 0x18, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x03, 0xff, 0x10, 0xff, 0x12, 0xff, 0x23, 0xff,
+   0x14, 0xff, 0x24, 0xff, 0xff, 0x14, 0x24, 0x24, 0xff, 0xff, 0x23, 0xff,
+   0x10, 0x13, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0x12,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24,
+   0x20, 0x0f, 0xff, 0x10, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+   0x22, 0x12, 0xff, 0xff, 0xff, 0xff, 0x24, 0x01, 0xff, 0x00, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff,
+   0x02, 0xff, 0x22, 0xff, 0xff, 0x12, 0x22, 0x02, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x20, 0x01, 0xff, 0x10, 0xff, 0x13,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xff, 0x25,
+   0xff, 0xff, 0x15, 0x20, 0x0f, 0xff, 0x22, 0x01, 0xff, 0x12, 0xff, 0x22,
+   0xff, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0x28, 0xff, 0x10, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x11, 0x21, 0xff, 0x10, 0xff, 0x18,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff, 0xff, 0x21, 0xff, 0x01,
+   0xff, 0xff, 0x28, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0x22, 0xff, 0xff, 0x12,
+   0x24, 0x24, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24,
+   0x23, 0x13, 0xff, 0x10, 0xff, 0x13, 0xff, 0x23, 0xff, 0xff, 0xff, 0x24,
+   0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x24, 0x00, 0xff, 0x24, 0xff, 0xff, 0x14, 0x20, 0x0f, 0xff,
+   0x22, 0x12, 0xff, 0x12, 0xff, 0x22, 0xff, 0x24, 0xff, 0x00, 0xff, 0x24,
+   0xff, 0xff, 0x04, 0x24, 0x24, 0xff, 0xff, 0x11, 0xff, 0x10, 0x14, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x13, 0xff, 0x23,
+   0xff, 0xff, 0x13, 0x23, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x12, 0xff, 0x22,
+   0xff, 0xff, 0x12, 0x22, 0x02, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x10, 0x18, 0xff, 0x10, 0xff, 0x18, 0xff, 0x28, 0xff,
+   0x11, 0x21, 0xff, 0x10, 0xff, 0x18, 0xff, 0x0f, 0xff, 0x21, 0xff, 0x28,
+   0xff, 0xff, 0x28, 0x0f, 0xff, 0xff, 0xff, 0x23, 0xff, 0x10, 0x13, 0xff,
+   0xff, 0xff, 0xff, 0x21, 0xff, 0x01, 0xff, 0xff, 0x28, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x20, 0x0f, 0xff,
+   0x10, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x22, 0x12, 0xff,
+   0xff, 0xff, 0xff, 0x28, 0x21, 0xff, 0x00, 0xff, 0x28, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x24, 0x01, 0xff, 0x00, 0xff, 0x24,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24,
+   0xff, 0xff, 0x14, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x01, 0xff, 0x12, 0xff, 0x22,
+   0xff, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0x23, 0xff, 0x18, 0x28, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0x12, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x28, 0xff, 0x18, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0x22, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0x28, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0x28, 0x28, 0xff, 0x28, 0xff, 0x18, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff,
+   0x18, 0x28, 0xff, 0xff, 0xff, 0xff, 0x28, 0x28, 0xff, 0x28, 0xff, 0x03,
+   0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0x25, 0x28, 0xff, 0x28, 0xff, 0x25, 0xff, 0x25, 0xff, 0x28, 0xff, 0x25,
+   0xff, 0xff, 0x28, 0x25, 0x28, 0xff, 0xff, 0x25, 0xff, 0x25, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0x28, 0x28, 0xff, 0x28, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x24, 0x28, 0xff, 0x28, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0x28, 0xff, 0x24, 0xff, 0xff, 0x28, 0x24, 0x24, 0xff,
+   0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x23, 0x28, 0xff, 0x28, 0xff, 0x23, 0xff, 0x23, 0xff, 0x28, 0xff, 0x23,
+   0xff, 0xff, 0x23, 0x23, 0x28, 0xff, 0xff, 0x23, 0xff, 0x23, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0x00, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0x28, 0x28, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x01, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x28, 0x21, 0xff,
+   0x28, 0xff, 0x28, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0x18, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0x18, 0x28, 0xff, 0x28, 0xff, 0x18, 0xff, 0x28, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0x22,
+   0xff, 0xff, 0x14, 0x22, 0x14, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff,
+   0x05, 0xff, 0x25, 0x20, 0x04, 0xff, 0x14, 0xff, 0x27, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0x14, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x10, 0xff, 0x11, 0xff, 0xff, 0x14,
+   0x20, 0x04, 0xff, 0x22, 0x14, 0xff, 0x14, 0xff, 0x26, 0xff, 0x24, 0xff,
+   0x05, 0xff, 0x25, 0xff, 0xff, 0x26, 0x25, 0x04, 0xff, 0xff, 0x24, 0xff,
+   0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff,
+   0x00, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03,
+   0x10, 0xff, 0x11, 0xff, 0xff, 0x17, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0x00, 0xff, 0x26, 0xff, 0xff, 0x26, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x26,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x25, 0x20, 0x0f, 0xff, 0x00, 0xff, 0x27,
+   0xff, 0xff, 0xff, 0x10, 0x11, 0xff, 0x10, 0xff, 0x12, 0xff, 0x17, 0xff,
+   0x15, 0xff, 0x25, 0xff, 0xff, 0x15, 0x25, 0x27, 0xff, 0xff, 0x26, 0xff,
+   0x16, 0x26, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x12,
+   0x17, 0x27, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x27, 0xff, 0x25,
+   0x26, 0x26, 0xff, 0x26, 0xff, 0x16, 0xff, 0x26, 0xff, 0xff, 0x15, 0xff,
+   0x15, 0x25, 0xff, 0xff, 0xff, 0xff, 0x25, 0x25, 0xff, 0x25, 0xff, 0x25,
+   0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x20, 0xff, 0x01, 0xff, 0xff, 0x26,
+   0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x12, 0xff, 0x22, 0xff, 0xff, 0x26,
+   0x22, 0x02, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0x10, 0x14, 0xff, 0x26, 0xff, 0x16, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x20, 0xff, 0x01,
+   0xff, 0xff, 0x26, 0x20, 0x0f, 0xff, 0x12, 0xff, 0x22, 0xff, 0xff, 0x12,
+   0x22, 0x27, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0x16, 0x26, 0xff, 0x26, 0xff, 0x16, 0xff, 0x03, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0x27, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x26, 0xff, 0x01, 0xff, 0xff, 0x26, 0x00, 0x26, 0xff,
+   0x22, 0x12, 0xff, 0x12, 0xff, 0x22, 0xff, 0x22, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x16, 0xff, 0x16, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0x24, 0x14, 0xff, 0x14, 0xff, 0x27, 0xff, 0x24, 0xff,
+   0x14, 0xff, 0x26, 0xff, 0xff, 0x23, 0x24, 0x24, 0xff, 0xff, 0x24, 0xff,
+   0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x14,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0x14, 0xff, 0x26,
+   0x20, 0x01, 0xff, 0x00, 0xff, 0x27, 0xff, 0x24, 0xff, 0xff, 0x24, 0xff,
+   0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0x24, 0x24, 0xff, 0x24, 0xff, 0x04,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0x00, 0xff, 0x26, 0xff, 0xff, 0x17, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x16,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x26, 0x20, 0x0f, 0xff, 0x00, 0xff, 0x27,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x10, 0xff, 0x12,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x17, 0x20, 0x0f, 0xff, 0x20, 0x0f, 0xff, 0x00, 0xff, 0x27,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x26, 0xff, 0xff, 0x26, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff,
+   0x13, 0x23, 0xff, 0xff, 0xff, 0xff, 0x13, 0x23, 0xff, 0x23, 0xff, 0x13,
+   0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff,
+   0x26, 0x16, 0xff, 0x10, 0xff, 0x12, 0xff, 0x26, 0xff, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x16, 0x17, 0x27, 0xff, 0xff, 0x26, 0xff, 0x26, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff,
+   0x07, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03,
+   0x07, 0xff, 0x27, 0xff, 0xff, 0x17, 0x27, 0x03, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0x07, 0xff, 0x27, 0xff, 0xff, 0x07, 0x27, 0x02, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0x27, 0x01, 0xff, 0x17, 0xff, 0x27,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x00, 0xff, 0x27, 0xff, 0xff, 0x17, 0x20, 0x0f, 0xff,
+   0x17, 0xff, 0x27, 0xff, 0xff, 0x17, 0x27, 0x27, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x27, 0xff, 0x25, 0x27, 0x01, 0xff, 0x17, 0xff, 0x27,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x27, 0xff, 0x27,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0x00, 0xff, 0x27,
+   0xff, 0xff, 0x17, 0x20, 0x0f, 0xff, 0x27, 0x25, 0xff, 0x25, 0xff, 0x27,
+   0xff, 0x27, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x25, 0x25, 0xff,
+   0xff, 0x27, 0xff, 0x27, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x17, 0xff, 0x27,
+   0xff, 0xff, 0x17, 0x27, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x27, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x17, 0xff, 0x27,
+   0xff, 0xff, 0x17, 0x27, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0x02, 0x22, 0x27, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x27, 0x17, 0xff, 0x17, 0xff, 0x27, 0xff, 0x27, 0xff,
+   0x07, 0xff, 0x27, 0xff, 0xff, 0x17, 0x27, 0x02, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0x27, 0x01, 0xff, 0x07, 0xff, 0x27,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0x00, 0xff, 0x27,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0xff, 0x27,
+   0xff, 0xff, 0x17, 0x20, 0x0f, 0xff, 0x27, 0x24, 0xff, 0x24, 0xff, 0x27,
+   0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff,
+   0xff, 0x24, 0xff, 0x27, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x00, 0xff, 0x27, 0xff, 0xff, 0x17, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0x00, 0xff, 0x22, 0xff, 0xff, 0x02, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0x00, 0xff, 0x27, 0xff, 0xff, 0xff, 0x27, 0x23, 0xff, 0x23, 0xff, 0x27,
+   0xff, 0x23, 0xff, 0x23, 0xff, 0x27, 0xff, 0xff, 0x23, 0x27, 0x23, 0xff,
+   0xff, 0x23, 0xff, 0x27, 0x23, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x27,
+   0xff, 0xff, 0x17, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff,
+   0x27, 0xff, 0x27, 0x20, 0x0f, 0xff, 0x00, 0xff, 0x27, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x04, 0xff, 0x10, 0xff, 0x13, 0xff, 0x24, 0xff,
+   0x05, 0xff, 0x25, 0xff, 0xff, 0x23, 0x25, 0x03, 0xff, 0xff, 0x24, 0xff,
+   0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0x25, 0xff, 0xff, 0x14,
+   0x24, 0x24, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x15, 0xff, 0x25,
+   0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x25, 0x01, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0x10, 0xff, 0x13, 0xff, 0xff, 0x23, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x23,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x25, 0x20, 0x0f, 0xff, 0x00, 0xff, 0x27,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x00, 0xff, 0x25,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0x00, 0xff, 0x25,
+   0xff, 0xff, 0x05, 0x20, 0x0f, 0xff, 0x20, 0x0f, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+   0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0x25, 0x01, 0xff, 0x00, 0xff, 0x25,
+   0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0x12, 0x22, 0xff, 0x22, 0xff, 0x12, 0xff, 0x02, 0xff, 0x15, 0xff, 0x25,
+   0xff, 0xff, 0x15, 0x25, 0x27, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0x22, 0xff, 0xff, 0x23,
+   0x22, 0x02, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0x24, 0x24, 0xff, 0x24, 0xff, 0x03, 0xff, 0x24, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff,
+   0x22, 0x01, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x22, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x24, 0xff, 0x00, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xff, 0x23,
+   0xff, 0xff, 0x23, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x22, 0x22, 0xff, 0x22, 0xff, 0x22, 0xff, 0x22, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x22, 0x22, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0x22, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x10, 0xff, 0x13,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0x10, 0x14, 0xff, 0x10, 0xff, 0x12, 0xff, 0x24, 0xff, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x14, 0x10, 0x14, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x00, 0xff, 0x27,
+   0xff, 0xff, 0xff, 0x10, 0xff, 0x13, 0xff, 0xff, 0x23, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x17, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff,
+   0x10, 0xff, 0x17, 0x20, 0x0f, 0xff, 0x00, 0xff, 0x27, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x12, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0x10, 0x11, 0xff, 0x10, 0xff, 0x17, 0xff, 0x17, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x16, 0xff, 0x26, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x06, 0xff, 0x26, 0xff, 0xff, 0x03,
+   0x26, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26,
+   0x26, 0x02, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x00, 0xff, 0x25,
+   0x26, 0x01, 0xff, 0x00, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x00, 0xff, 0x26,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x20, 0x0f, 0xff, 0x16, 0xff, 0x26, 0xff, 0xff, 0x26,
+   0x26, 0x16, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x25,
+   0x26, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0xff, 0x16,
+   0xff, 0xff, 0xff, 0x16, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x05, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff,
+   0x26, 0x25, 0xff, 0x25, 0xff, 0x26, 0xff, 0x26, 0xff, 0x25, 0xff, 0x25,
+   0xff, 0xff, 0x25, 0x25, 0x25, 0xff, 0xff, 0x26, 0xff, 0x26, 0x25, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x04, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0x00, 0xff, 0x22, 0xff, 0xff, 0x26, 0x22, 0x02, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x26, 0x26, 0xff,
+   0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0x06, 0xff, 0x26, 0xff, 0xff, 0x02,
+   0x26, 0x02, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0x16, 0xff, 0x26,
+   0x26, 0x01, 0xff, 0x00, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0x16,
+   0xff, 0xff, 0xff, 0x16, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x16, 0x06, 0xff, 0x26, 0xff, 0xff, 0x04, 0x26, 0x04, 0xff,
+   0x26, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x26,
+   0xff, 0xff, 0x24, 0x26, 0x24, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x26,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff,
+   0x00, 0xff, 0x26, 0x20, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x26, 0x23, 0xff, 0x23, 0xff, 0x26, 0xff, 0x26, 0xff, 0x23, 0xff, 0x26,
+   0xff, 0xff, 0x23, 0x26, 0x23, 0xff, 0xff, 0x26, 0xff, 0x26, 0x23, 0xff,
+   0xff, 0xff, 0xff, 0x16, 0xff, 0x26, 0xff, 0xff, 0x16, 0x26, 0x16, 0xff,
+   0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0x16, 0xff, 0x26, 0x26, 0x26, 0xff,
+   0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x03, 0xff, 0xff, 0x23,
+   0x10, 0x14, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x15, 0xff, 0x25,
+   0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0x22, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x15, 0x24, 0xff, 0x01, 0xff, 0xff, 0x24, 0x00, 0x24, 0xff,
+   0x00, 0x24, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x24, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x25, 0x04, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x20, 0xff, 0x02,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0x20, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x12, 0x22, 0xff, 0x22, 0xff, 0x02, 0xff, 0x12, 0xff, 0x15, 0xff, 0x25,
+   0xff, 0xff, 0x23, 0x25, 0x15, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x22, 0xff, 0x12, 0xff, 0xff, 0x22, 0x12, 0x22, 0xff,
+   0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x15, 0xff, 0x25, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0x25, 0x25, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x25, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23,
+   0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x24, 0xff, 0x01, 0xff, 0xff, 0x23, 0x00, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x22, 0x02, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0x24, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x22, 0x22, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x22, 0x22, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x23, 0xff, 0x13,
+   0xff, 0xff, 0x23, 0x10, 0x14, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x14, 0x10, 0x14, 0xff,
+   0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x10, 0xff, 0x14, 0x24, 0x24, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0x24, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff,
+   0x10, 0xff, 0x13, 0x20, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xff, 0x21, 0xff, 0xff, 0x0f,
+   0x20, 0x0f, 0xff, 0x20, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0x13, 0x23, 0xff, 0x23, 0xff, 0x13, 0xff, 0x13, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x12, 0x22, 0xff,
+   0x22, 0xff, 0x12, 0xff, 0x12, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x1f,
+   0x10, 0x1f, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x22, 0x14, 0xff, 0x10, 0xff, 0x12, 0xff, 0x24, 0xff,
+   0x05, 0xff, 0x25, 0xff, 0xff, 0x15, 0x25, 0x24, 0xff, 0xff, 0x24, 0xff,
+   0x10, 0x14, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0x25, 0xff, 0xff, 0x12,
+   0x24, 0x24, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x24, 0xff, 0x25,
+   0x20, 0x01, 0xff, 0x10, 0xff, 0x14, 0xff, 0x24, 0xff, 0xff, 0x24, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x25, 0x01, 0xff, 0x00, 0xff, 0x25,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0x00, 0xff, 0x22, 0xff, 0xff, 0x12, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x25, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x13,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x00, 0xff, 0x25,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x00, 0xff, 0x25,
+   0xff, 0xff, 0x15, 0x20, 0x0f, 0xff, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x16,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x25, 0xff, 0xff, 0x26, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff,
+   0x22, 0x12, 0xff, 0xff, 0xff, 0xff, 0x25, 0x21, 0xff, 0x00, 0xff, 0x25,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff,
+   0x11, 0x21, 0xff, 0x10, 0xff, 0x12, 0xff, 0x0f, 0xff, 0x21, 0xff, 0x25,
+   0xff, 0xff, 0x15, 0x0f, 0xff, 0xff, 0xff, 0x26, 0xff, 0x16, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0x22, 0xff, 0xff, 0x12,
+   0x22, 0x24, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0x24, 0x24, 0xff, 0x10, 0xff, 0x13, 0xff, 0x24, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x24, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x24, 0xff, 0x24, 0xff, 0xff, 0x14, 0x24, 0x24, 0xff,
+   0x22, 0x01, 0xff, 0x12, 0xff, 0x22, 0xff, 0x22, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x24, 0xff, 0x10, 0x14, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xff, 0x23,
+   0xff, 0xff, 0x13, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0x26, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x16, 0xff, 0xff, 0xff,
+   0x22, 0x21, 0xff, 0x12, 0xff, 0x22, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x16, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0x21, 0xff, 0x22, 0xff, 0xff, 0x12, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff,
+   0x26, 0xff, 0x16, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0x22, 0x12, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x10, 0xff, 0x13,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x01, 0xff, 0x10, 0xff, 0x12, 0xff, 0x24, 0xff, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x14, 0x24, 0x24, 0xff, 0xff, 0x24, 0xff, 0x20, 0x04, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x12,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x26, 0xff, 0xff, 0x16, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x12, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff,
+   0x00, 0xff, 0x26, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x16, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0x00, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x20, 0x02, 0xff,
+   0xff, 0xff, 0xff, 0x11, 0x21, 0xff, 0x10, 0xff, 0x16, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x14, 0xff, 0x22, 0xff, 0xff, 0x12, 0x24, 0x24, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x20, 0x01, 0xff, 0x10, 0xff, 0x13,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x24, 0xff, 0x02,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x14, 0x20, 0x0f, 0xff, 0x22, 0x24, 0xff, 0x12, 0xff, 0x22,
+   0xff, 0x24, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0x04, 0x24, 0x24, 0xff,
+   0xff, 0x24, 0xff, 0x10, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x10, 0xff, 0x11, 0xff, 0xff, 0x13, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0x00, 0xff, 0x22, 0xff, 0xff, 0x12, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0x10, 0xff, 0x15, 0xff, 0xff, 0xff, 0x11, 0x21, 0xff, 0x10, 0xff, 0x12,
+   0xff, 0x0f, 0xff, 0x21, 0xff, 0x25, 0xff, 0xff, 0x15, 0x0f, 0xff, 0xff,
+   0xff, 0x23, 0xff, 0x10, 0x13, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x11,
+   0xff, 0xff, 0x12, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x15, 0xff, 0xff, 0xff,
+   0xff, 0x01, 0xff, 0x15, 0x25, 0xff, 0xff, 0xff, 0xff, 0x25, 0x21, 0xff,
+   0x25, 0xff, 0x25, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0x24, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x21, 0xff, 0x11,
+   0xff, 0xff, 0x13, 0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x12, 0xff, 0x22,
+   0xff, 0xff, 0x12, 0x22, 0x24, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x10, 0x14, 0xff, 0x10, 0xff, 0x14, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff,
+   0x00, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0x10, 0xff, 0x11, 0xff, 0xff, 0x1f, 0x20, 0x0f, 0xff, 0x21, 0xff, 0x22,
+   0xff, 0xff, 0x12, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x11, 0x21, 0xff, 0x10, 0xff, 0x13, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x11, 0xff, 0xff, 0x1f,
+   0x0f, 0xff, 0xff, 0x22, 0x21, 0xff, 0x12, 0xff, 0x22, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff,
+   0x10, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x10, 0xff, 0x12,
+   0xff, 0x23, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x14, 0x24, 0x24, 0xff,
+   0xff, 0x23, 0xff, 0x20, 0x03, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11,
+   0xff, 0xff, 0x12, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff,
+   0x24, 0xff, 0x24, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x14, 0xff, 0xff, 0xff,
+   0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0x24, 0x24, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x22, 0xff, 0xff, 0x12, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0x10, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff,
+   0x00, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0x10, 0xff, 0x11, 0xff, 0xff, 0x1f, 0x20, 0x0f, 0xff, 0x20, 0x0f, 0xff,
+   0x00, 0xff, 0x22, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x23, 0xff, 0x13, 0x23, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff,
+   0x23, 0xff, 0x13, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0xff,
+   0x21, 0xff, 0x11, 0xff, 0xff, 0x1f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x25, 0x01, 0xff, 0x00, 0xff, 0x25,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+   0x24, 0x24, 0xff, 0x00, 0xff, 0x25, 0xff, 0x24, 0xff, 0x05, 0xff, 0x25,
+   0xff, 0xff, 0x15, 0x25, 0x24, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x13,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x25, 0xff, 0xff, 0x23, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x25,
+   0xff, 0xff, 0x15, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff,
+   0x00, 0xff, 0x25, 0x20, 0x0f, 0xff, 0x00, 0xff, 0x25, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x22, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0x25, 0x21, 0xff, 0x00, 0xff, 0x25, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x22, 0x01, 0xff, 0x02, 0xff, 0x22, 0xff, 0x22, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x22, 0xff, 0xff, 0x02, 0x22, 0x24, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x24, 0x24, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x22, 0xff, 0x22, 0x02, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0x23, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x00, 0xff, 0x23, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0x0f, 0xff, 0x20, 0x0f, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x22, 0x21, 0xff,
+   0x22, 0xff, 0x22, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x20, 0x02, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x10, 0xff, 0x14, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0x10, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0xff,
+   0x10, 0xff, 0x11, 0xff, 0xff, 0x1f, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x00, 0xff, 0x24, 0xff, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0x26, 0x26, 0xff,
+   0x22, 0xff, 0x24, 0xff, 0x26, 0xff, 0x16, 0xff, 0x24, 0xff, 0xff, 0x24,
+   0x24, 0x16, 0xff, 0xff, 0x26, 0xff, 0x05, 0x25, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x10, 0x12, 0xff, 0x17, 0xff, 0x27, 0xff, 0x23, 0xff,
+   0x16, 0xff, 0x26, 0xff, 0xff, 0x03, 0x26, 0x16, 0xff, 0xff, 0x15, 0xff,
+   0x27, 0x25, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0x25, 0xff, 0xff, 0x02,
+   0x25, 0x02, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x25,
+   0x25, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x21, 0xff,
+   0x27, 0x02, 0xff, 0xff, 0xff, 0xff, 0x26, 0x01, 0xff, 0x00, 0xff, 0x26,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x20, 0x02, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x01, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x13, 0xff,
+   0x26, 0xff, 0x24, 0xff, 0x23, 0xff, 0x26, 0xff, 0x24, 0xff, 0xff, 0x24,
+   0x24, 0x27, 0xff, 0xff, 0x23, 0xff, 0x24, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x02, 0xff, 0xff, 0xff, 0x24,
+   0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0x01, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0xff, 0x11, 0xff, 0x10, 0x12, 0xff, 0xff, 0xff, 0xff,
+   0x10, 0x11, 0xff, 0x20, 0xff, 0x04, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x23, 0xff, 0xff, 0x02,
+   0x23, 0x13, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x23,
+   0x23, 0x13, 0xff, 0x00, 0xff, 0x23, 0xff, 0x23, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0x10, 0x11, 0xff, 0x17, 0xff, 0x27, 0xff, 0x12, 0xff, 0x26, 0xff, 0x26,
+   0xff, 0xff, 0x26, 0x26, 0x16, 0xff, 0xff, 0x11, 0xff, 0x27, 0x17, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x10, 0x12, 0xff, 0xff, 0xff, 0xff,
+   0x10, 0x11, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0x00, 0x26, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0x26, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x27, 0xff,
+   0xff, 0x26, 0xff, 0x00, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x01, 0xff, 0x00, 0xff, 0x24, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+   0x27, 0x22, 0xff, 0xff, 0xff, 0xff, 0x26, 0x01, 0xff, 0x00, 0xff, 0x26,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0x12, 0x22, 0xff, 0x22, 0xff, 0x27, 0xff, 0x26, 0xff, 0x16, 0xff, 0x26,
+   0xff, 0xff, 0x06, 0x26, 0x16, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x03, 0xff, 0x12, 0xff, 0x24, 0xff, 0x23, 0xff,
+   0x04, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x03, 0xff, 0xff, 0x23, 0xff,
+   0x15, 0x25, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0x24,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24,
+   0x20, 0x0f, 0xff, 0x25, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+   0x22, 0x12, 0xff, 0xff, 0xff, 0xff, 0x24, 0x01, 0xff, 0x00, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff,
+   0x12, 0xff, 0x22, 0xff, 0xff, 0x02, 0x22, 0x02, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x15, 0x25, 0xff, 0x25, 0xff, 0x27,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x25, 0xff, 0x25,
+   0xff, 0xff, 0x25, 0x20, 0x0f, 0xff, 0x22, 0x12, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0x15, 0xff, 0x27, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x20, 0x01, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x24, 0xff, 0xff, 0x24,
+   0x23, 0x13, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24,
+   0x23, 0x13, 0xff, 0x13, 0xff, 0x24, 0xff, 0x23, 0xff, 0xff, 0xff, 0x24,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x24, 0x00, 0xff, 0x24, 0xff, 0xff, 0x24, 0x20, 0x0f, 0xff,
+   0x10, 0x11, 0xff, 0x12, 0xff, 0x24, 0xff, 0x12, 0xff, 0x14, 0xff, 0x24,
+   0xff, 0xff, 0x24, 0x24, 0x14, 0xff, 0xff, 0x11, 0xff, 0x10, 0x14, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x13, 0xff, 0x23,
+   0xff, 0xff, 0x03, 0x23, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x12, 0xff, 0x22,
+   0xff, 0xff, 0x02, 0x22, 0x12, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x10, 0x11, 0xff, 0x17, 0xff, 0x27, 0xff, 0x17, 0xff,
+   0x10, 0x13, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x23, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x00, 0x27, 0xff, 0xff, 0x23, 0xff, 0x10, 0x13, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0x0f, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x10, 0x12, 0xff,
+   0xff, 0xff, 0xff, 0x10, 0x11, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x17, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff,
+   0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0x24, 0x01, 0xff, 0x00, 0xff, 0x24,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0x22, 0xff, 0x02, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24,
+   0xff, 0xff, 0x24, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x22, 0xff, 0x22, 0xff, 0x22,
+   0xff, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22,
+   0xff, 0xff, 0x22, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0x07, 0x27, 0xff, 0xff, 0xff, 0xff,
+   0x17, 0x27, 0xff, 0x27, 0xff, 0x04, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xff,
+   0x27, 0x27, 0xff, 0xff, 0xff, 0xff, 0x17, 0x27, 0xff, 0x27, 0xff, 0x27,
+   0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff,
+   0x25, 0x27, 0xff, 0x27, 0xff, 0x25, 0xff, 0x25, 0xff, 0x27, 0xff, 0x25,
+   0xff, 0xff, 0x27, 0x25, 0x27, 0xff, 0xff, 0x25, 0xff, 0x25, 0x25, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x17, 0xff, 0x07, 0x27, 0xff, 0xff, 0xff, 0xff,
+   0x07, 0x27, 0xff, 0x27, 0xff, 0x03, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x24, 0x27, 0xff, 0x27, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0x27, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x27, 0xff,
+   0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x23, 0x27, 0xff, 0x27, 0xff, 0x23, 0xff, 0x23, 0xff, 0x27, 0xff, 0x23,
+   0xff, 0xff, 0x23, 0x23, 0x27, 0xff, 0xff, 0x23, 0xff, 0x23, 0x27, 0xff,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xff, 0x27, 0x27, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0x27, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x17, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x01, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x27, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x27, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0x17, 0x27, 0xff, 0x27, 0xff, 0x27, 0xff, 0x17, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x11, 0xff,
+   0x24, 0xff, 0x24, 0xff, 0x12, 0xff, 0x11, 0xff, 0x24, 0xff, 0xff, 0x24,
+   0x10, 0x13, 0xff, 0xff, 0x15, 0xff, 0x24, 0x25, 0xff, 0xff, 0xff, 0xff,
+   0x22, 0xff, 0x24, 0xff, 0xff, 0x24, 0x10, 0x16, 0xff, 0xff, 0xff, 0x24,
+   0xff, 0xff, 0xff, 0x14, 0xff, 0x24, 0x05, 0x25, 0xff, 0x25, 0xff, 0x24,
+   0xff, 0x26, 0xff, 0xff, 0x21, 0xff, 0x24, 0x02, 0xff, 0xff, 0xff, 0xff,
+   0x21, 0x11, 0xff, 0x00, 0xff, 0x24, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x21, 0xff, 0xff, 0x0f,
+   0x10, 0x12, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x16, 0xff, 0x26,
+   0x21, 0x25, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x15, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x05, 0x25, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x25, 0x25, 0xff,
+   0x21, 0x11, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x12, 0xff, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x26, 0x16, 0xff, 0xff, 0x21, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0x10, 0x11, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x10, 0x16, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0x26, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0x16, 0xff,
+   0xff, 0x26, 0xff, 0x00, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x11, 0xff, 0x24, 0xff, 0xff, 0x24, 0x10, 0x13, 0xff, 0xff, 0xff, 0x24,
+   0xff, 0xff, 0xff, 0x13, 0xff, 0x24, 0x24, 0x13, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x14, 0xff, 0x24,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x24, 0xff, 0x24,
+   0xff, 0xff, 0x24, 0x24, 0x04, 0xff, 0x10, 0x11, 0xff, 0x14, 0xff, 0x24,
+   0xff, 0x12, 0xff, 0x20, 0xff, 0x01, 0xff, 0xff, 0x24, 0x10, 0x14, 0xff,
+   0xff, 0x11, 0xff, 0x24, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+   0xff, 0xff, 0xff, 0x13, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x03, 0x00, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x23, 0x13, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x11, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x10, 0x12, 0xff,
+   0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x16, 0xff, 0x26, 0x21, 0x11, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0x16, 0xff, 0x10, 0x11, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0x12, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0x13, 0xff,
+   0xff, 0x16, 0xff, 0x00, 0x26, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x10, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0x00, 0x26, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x26, 0xff,
+   0xff, 0x11, 0xff, 0x10, 0x12, 0xff, 0xff, 0xff, 0xff, 0x10, 0x11, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x24, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0x21, 0x01, 0xff, 0x00, 0xff, 0x24, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x22, 0x22, 0xff, 0x22, 0xff, 0x24,
+   0xff, 0x26, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0x24, 0x26, 0x16, 0xff,
+   0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x21, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x12, 0xff, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x26, 0x16, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x22, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x12, 0x22, 0xff,
+   0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x16, 0xff, 0x26, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x21, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x21, 0x01, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x26, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x20, 0x01, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x24, 0xff, 0xff, 0x24,
+   0x10, 0x13, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x14, 0xff, 0x24,
+   0x05, 0x25, 0xff, 0x25, 0xff, 0x24, 0xff, 0x23, 0xff, 0xff, 0xff, 0x24,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x24, 0x25, 0xff, 0x01, 0xff, 0xff, 0x24, 0x20, 0x0f, 0xff,
+   0x24, 0x25, 0xff, 0x24, 0xff, 0x24, 0xff, 0x12, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0xff, 0x24, 0x24, 0x14, 0xff, 0xff, 0x15, 0xff, 0x24, 0x25, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x25, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x00, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x00, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x22, 0x12, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x21, 0x25, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x15, 0xff,
+   0x10, 0x13, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x23, 0xff, 0x20, 0xff, 0x0f,
+   0xff, 0xff, 0xff, 0x10, 0x13, 0xff, 0xff, 0x23, 0xff, 0x00, 0x25, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0x0f, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0x00, 0x25, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0x25, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x15, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24,
+   0xff, 0xff, 0xff, 0x20, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x24, 0x20, 0xff, 0x01, 0xff, 0xff, 0x24, 0x10, 0x13, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0x11, 0xff, 0x24, 0xff, 0xff, 0x24, 0x10, 0x12, 0xff,
+   0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x14, 0xff, 0x24, 0x10, 0x11, 0xff,
+   0x14, 0xff, 0x24, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x12, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x11, 0xff, 0x21, 0xff, 0xff, 0x0f,
+   0x10, 0x1f, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0x13, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x10, 0x13, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x10, 0x11, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x12, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x10, 0x1f, 0xff, 0xff, 0x11, 0xff, 0x10, 0x1f, 0xff, 0xff, 0xff, 0xff,
+   0x02, 0x22, 0xff, 0x22, 0xff, 0x24, 0xff, 0x23, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0xff, 0x24, 0x24, 0x03, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x22, 0xff, 0x01, 0xff, 0xff, 0x22, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x24, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x22, 0x22, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x21, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x22, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x00, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0x23, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x23, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x24, 0x02, 0xff, 0xff, 0xff, 0xff,
+   0x21, 0x11, 0xff, 0x00, 0xff, 0x24, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x24, 0x22, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0x12, 0xff, 0x11, 0xff, 0x24, 0xff, 0xff, 0x24, 0x10, 0x14, 0xff,
+   0xff, 0x01, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x21, 0x11, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x12, 0xff, 0x11, 0xff, 0x21,
+   0xff, 0xff, 0x0f, 0x10, 0x13, 0xff, 0xff, 0x21, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x25, 0x15, 0xff,
+   0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x15, 0xff, 0x25, 0x21, 0x25, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0x21, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x21, 0x11, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x15, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x12, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x10, 0x11, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x11, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0x12, 0xff, 0x20, 0xff, 0x01, 0xff, 0xff, 0x23, 0x10, 0x13, 0xff,
+   0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0xff, 0x24, 0x24, 0x14, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff,
+   0x14, 0xff, 0x24, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff,
+   0xff, 0x21, 0xff, 0x24, 0x02, 0xff, 0xff, 0xff, 0xff, 0x10, 0x11, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x21, 0xff, 0xff, 0x0f, 0x23, 0x13, 0xff,
+   0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x13, 0xff, 0x23, 0x21, 0x01, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x21, 0x11, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0x12, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x10, 0x1f, 0xff, 0xff, 0x21, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x12, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x10, 0x11, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0x22, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x12, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0x1f, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x12, 0xff, 0x24, 0x22, 0xff, 0xff, 0xff, 0xff, 0x21, 0x11, 0xff,
+   0x00, 0xff, 0x24, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x21, 0x11, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x13, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0x22, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0x12, 0xff, 0x11, 0xff, 0x21, 0xff, 0xff, 0x0f,
+   0x10, 0x1f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0x26, 0x26, 0xff, 0x26, 0xff, 0x04, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff,
+   0x16, 0x26, 0xff, 0xff, 0xff, 0xff, 0x26, 0x26, 0xff, 0x26, 0xff, 0x26,
+   0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff,
+   0x25, 0x26, 0xff, 0x26, 0xff, 0x25, 0xff, 0x25, 0xff, 0x26, 0xff, 0x25,
+   0xff, 0xff, 0x26, 0x25, 0x26, 0xff, 0xff, 0x25, 0xff, 0x25, 0x25, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x26, 0xff, 0xff, 0xff, 0xff,
+   0x06, 0x26, 0xff, 0x26, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0x24, 0x26, 0xff, 0x26, 0xff, 0x24,
+   0xff, 0x24, 0xff, 0x26, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff,
+   0xff, 0x24, 0xff, 0x24, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x23, 0x26, 0xff, 0x26, 0xff, 0x23, 0xff, 0x23, 0xff, 0x26, 0xff, 0x23,
+   0xff, 0xff, 0x26, 0x23, 0x26, 0xff, 0xff, 0x23, 0xff, 0x23, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0x16, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0x26, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x26, 0xff, 0x00, 0x26, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x00, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0x26, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff,
+   0x20, 0x02, 0xff, 0xff, 0xff, 0xff, 0x24, 0x01, 0xff, 0x00, 0xff, 0x24,
+   0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0xff, 0x00, 0xff, 0x24,
+   0xff, 0xff, 0x24, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x01, 0xff, 0x12, 0xff, 0x22,
+   0xff, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0x23, 0xff, 0x15, 0x25, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0x02, 0x20, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0x22, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x23, 0x03, 0xff, 0x00, 0xff, 0x24, 0xff, 0x23, 0xff, 0x24, 0xff, 0x24,
+   0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff, 0x23, 0xff, 0x23, 0x13, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0x24, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x20, 0x0f, 0xff,
+   0x00, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0x12, 0xff,
+   0xff, 0xff, 0xff, 0x24, 0x01, 0xff, 0x00, 0xff, 0x24, 0xff, 0x24, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x22,
+   0xff, 0xff, 0x02, 0x22, 0x02, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0x23, 0x13, 0xff, 0x13, 0xff, 0x23, 0xff, 0x23, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f,
+   0xff, 0x0f, 0xff, 0x22, 0x12, 0xff, 0x12, 0xff, 0x22, 0xff, 0x22, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x11, 0xff,
+   0x10, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x20, 0x02, 0xff,
+   0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x21, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x00, 0xff, 0x24, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x22, 0xff, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0x20, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+   0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+   0xff, 0xff, 0xff,
+};
+
+#endif
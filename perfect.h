@@ -0,0 +1,20 @@
+/*
+This header describes the perfect play table for the
+3 x 3 game written by gentable into perfect-table.h. Each
+entry packs the value of the position for the player about
+to move with the cell of the best move.
+*/
+
+#ifndef PERFECT_H
+#define PERFECT_H
+
+#define PERFECT_LOSS 0
+#define PERFECT_DRAW 1
+#define PERFECT_WIN 2
+#define PERFECT_END 0xF     // Game is over, there is no move
+#define PERFECT_NONE 0xFF   // Position cannot be reached
+
+#define PERFECT_VALUE(entry) ((entry) >> 4)
+#define PERFECT_CELL(entry) ((entry) & 0xF)
+
+#endif
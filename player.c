@@ -2,13 +2,20 @@
 Group:   Nicholas Baranosky, Myles Spencer, Morgan McGuire
 Class:   Operating Systems
 Date:    Oct. 18, 2021
-Compile: gcc -o player player.c client-thread-2021.c
-Run:     ./player freebsd1.cs.scranton.edu 17100 client-thread-2021.h
+Compile: gcc -o player player.c client-thread-2021.c wire.c board.c
+Run:     ./player [-b name,password[,opponent]] freebsd1.cs.scranton.edu 17100
+         client-thread-2021.h [game id]
 
 This program connects to tic-tac-toe server using
 socket commands and represents a player. It contains
 functions to determine player status, send a move to
 the server, and determine win, loss, or draw.
+If the connection drops mid-game it reconnects and
+resumes the game with the token given at login.
+Given a game id it watches that game instead of playing.
+Given a name and password (-b) it plays on its own as a
+bot, logging in with them and taking a random free cell
+every turn without chatting, so it can be scripted.
 */
 
 #include <stdio.h>
@@ -16,6 +23,8 @@ the server, and determine win, loss, or draw.
 #include <unistd.h>
 #include <errno.h>
 #include <string.h>
+#include <signal.h>
+#include <time.h>
 #include <netdb.h>
 #include <sys/types.h>
 #include <netinet/in.h>
@@ -23,37 +32,87 @@ the server, and determine win, loss, or draw.
 #include <sys/socket.h>
 #include <arpa/inet.h>
 #include "client-thread-2021.h"
+#include "wire.h"
+#include "board.h"
 
 #define CHAT 'C'
 #define MOVE 'M'
+#define LOGIN 'L'
+#define RANKS 'R'
+#define RESUME 'S'
+#define WATCH 'W'
+#define TOP_RANKS 5 // Leaders shown before logging in
+#define LOST -2     // Connection to the server dropped
+#define RESUME_TRIES 10 // Seconds spent trying to reconnect
+#define PLAYING -1  // Result of a watched game that goes on
 
-void playGame(int playersockfd);
-void makeMove(int playersockfd);
-void recvBoard(int playersockfd);
-int recvUpdate(int playersockfd);
-void checkGameStat(int playersockfd, int gameStat);
-void player1(int playersockfd);
-void player2(int playersockfd);
-char getSymbolAtBoardLoc(char *board, int i, int j);
-int sendNamePass(int playersockfd);
-void recvNames(int playersockfd);
-void recvGameContext(int playersockfd);
-void sendChat(int playersockfd);
-void recvChat(int playersockfd);
+enum RESUMETURN {
+   THEIR_TURN,      // Opponent moves next and may chat first
+   THEIR_MOVE,      // Opponent's chat was sent, only their move is left
+   YOUR_TURN,       // Player moves next and may chat first
+   YOUR_MOVE        // Player's chat was sent, only their move is left
+};
+
+// Where to reconnect and what to resume with if the connection drops
+char *serverHost;
+char *serverPort;
+char playerName[21];
+int token[2];       // High and low halves of the token given at login
+
+// Login of a player who plays on their own, if bot is 1
+int bot;
+char botPassword[21];
+char botOpponent[21];
+
+int playGame(Reader *server);
+int playTurns(Reader *server, Board *board, int turn);
+int yourTurn(Reader *server, Board *board, int mayChat);
+int theirTurn(Reader *server, Board *board, int mayChat);
+int resumeGame(Reader *server, Board *board);
+int makeMove(Reader *server, Board *board, Message *msg);
+void chooseMove(Board *board, int *x, int *y);
+int recvBoard(Reader *server, Board *board);
+int recvUpdate(Reader *server, Board *board);
+void checkGameStat(Reader *server, int gameStat);
+int sendNamePass(Reader *server);
+void recvNames(Reader *server);
+void recvGameContext(Reader *server);
+void putRanksFrame(Message *frame, char *name);
+int recvRanks(Reader *server);
+void sendChat(Reader *server, Message *msg);
+void recvChat(Reader *server);
+void watchGame(Reader *server, int gameId);
 
 /* Main function which establishes connection to the
    server, starts the game, and closes the connection.
 */
 int main(int argc, char *argv[]) {
-   int playersockfd;  
+   int playersockfd, option;
+   Reader server;     // Buffers everything received from the server
 
+   // Read the bot's login
+   while((option = getopt(argc, argv, "b:")) != -1) {
+      if(option == 'b' && sscanf(optarg, "%20[^,],%20[^,],%20s", playerName,
+                                 botPassword, botOpponent) >= 2) {
+         bot = 1;
+      }
+      else {
+         printf("Bot needs a name and password\n");
+         exit(1);
+      }
+   }
    // Proper parameters are missing in run statement
-   if(argc != 4) {
+   if(argc - optind != 3 && argc - optind != 4) {
       printf("Missing proper parameters\n");
       exit(1);
    }
    
-   playersockfd = get_server_connection(argv[1], argv[2]);
+   // Dropped connections are noticed on the next read, not by a signal
+   signal(SIGPIPE, SIG_IGN);
+   srand(time(NULL) ^ getpid());
+   serverHost = argv[optind];
+   serverPort = argv[optind + 1];
+   playersockfd = get_server_connection(serverHost, serverPort);
    
    // Could not connect to the server
    if(playersockfd == -1) {
@@ -62,66 +121,101 @@ int main(int argc, char *argv[]) {
    }
    printf("Welcome to Tic-Tac-Toe\n\n");
 
-   // Player was logged in or registered
-   if(sendNamePass(playersockfd) > 0) {
-      playGame(playersockfd);
-      recvGameContext(playersockfd);
+   initReader(&server, playersockfd);
+
+   // Game id was given, watch it instead of playing
+   if(argc - optind == 4) {
+      watchGame(&server, atoi(argv[optind + 3]));
+      close(server.fd);
+      return 0;
+   }
+   // Player was logged in or registered and the game was played out
+   if(sendNamePass(&server) > 0 && playGame(&server) == 0) {
+      recvGameContext(&server);
    }
    // Game ended or player was not logged in or registered
-   close(playersockfd);
+   close(server.fd);
 }
 
 /* Player receives his/her own win, loss, and 
-   tie status as well as the opponent's. It is
-   then printed to the player. 
+   tie status and rating as well as the opponent's.
+   It is then printed to the player. 
 */
-void recvGameContext(int playersockfd) {
-   int nameSize, wins, losses, ties;
-   int opNameSize, opWins, opLosses, opTies;
+void recvGameContext(Reader *server) {
+   int nameSize, wins, losses, ties, rating;
+   int opNameSize, opWins, opLosses, opTies, opRating;
    char name[21];
    char opName[21];
 
    // Receiving names of player and opponent
-   recv(playersockfd, &nameSize, sizeof(int), 0);
-   recv(playersockfd, name, nameSize, 0);
-   recv(playersockfd, &opNameSize, sizeof(int), 0);
-   recv(playersockfd, opName, opNameSize, 0);
-
-   // Receiving win, loss, and tie stats of player and opponent
-   recv(playersockfd, &wins, sizeof(int), 0);
-   recv(playersockfd, &losses, sizeof(int), 0);
-   recv(playersockfd, &ties, sizeof(int), 0);
-   recv(playersockfd, &opWins, sizeof(int), 0);
-   recv(playersockfd, &opLosses, sizeof(int), 0);
-   recv(playersockfd, &opTies, sizeof(int), 0);
-
-   printf("%s: %dW/%dL/%dT - %s: %dW/%dL/%dT\n", name, wins, losses, ties,
-          opName, opWins, opLosses, opTies);
+   readInt(server, &nameSize);
+   readBytes(server, name, nameSize);
+   readInt(server, &opNameSize);
+   readBytes(server, opName, opNameSize);
+
+   // Receiving win, loss, and tie stats and rating of player and opponent
+   readInt(server, &wins);
+   readInt(server, &losses);
+   readInt(server, &ties);
+   readInt(server, &rating);
+   readInt(server, &opWins);
+   readInt(server, &opLosses);
+   readInt(server, &opTies);
+   readInt(server, &opRating);
+
+   printf("%s: %dW/%dL/%dT, rating %d - %s: %dW/%dL/%dT, rating %d\n", name,
+          wins, losses, ties, rating, opName, opWins, opLosses, opTies,
+          opRating);
 }
 
-/* Function accepts player's name and password and sends it
-   to the server.
+/* Function accepts player's name, password, and the opponent
+   they would like to play and sends them to the server
+   together in one login frame.
 */
-int sendNamePass(int playersockfd) {
+int sendNamePass(Reader *server) {
    char name[21];
    char password[21];
-   int nameSize, passSize, result;
+   char opponent[21];
+   Message frame;
+   int result;
    
-   printf("Enter name:\n");
-   scanf("%s", name);
-   printf("Enter password:\n");
-   scanf("%s", password);
+   // Bot logs in as it was told to
+   if(bot) {
+      strcpy(name, playerName);
+      strcpy(password, botPassword);
+      strcpy(opponent, botOpponent);
+   }
+   else {
+      printf("Enter name:\n");
+      scanf("%20s", name);
+      printf("Enter password:\n");
+      scanf("%20s", password);
+      printf("Enter opponent name, * for anyone, or bot for the computer:\n");
+      scanf("%20s", opponent);
+   }
+   // Empty opponent requests anyone
+   if(strcmp(opponent, "*") == 0) { opponent[0] = '\0'; }
    
-   passSize = strlen(password)+1;
-   nameSize = strlen(name)+1;
-   send(playersockfd, &nameSize, sizeof(int), 0);
-   send(playersockfd, name, nameSize, 0);
-   send(playersockfd, &passSize, sizeof(int), 0);
-   send(playersockfd, password, passSize, 0);
-   recv(playersockfd, &result, sizeof(int), 0);
+   // Rankings asked for with the login, answered before it
+   initMessage(&frame);
+   putRanksFrame(&frame, name);
+   // Frame type, all three sizes, then name, password, and opponent
+   putChar(&frame, LOGIN);
+   putInt(&frame, strlen(name)+1);
+   putInt(&frame, strlen(password)+1);
+   putInt(&frame, strlen(opponent)+1);
+   putBytes(&frame, name, strlen(name)+1);
+   putBytes(&frame, password, strlen(password)+1);
+   putBytes(&frame, opponent, strlen(opponent)+1);
+   sendMessage(server->fd, &frame);
+   // Server is gone or sent rankings that cannot be read past
+   if(recvRanks(server) == -1 || readInt(server, &result) == -1) { return -1; }
    
-   // Player was accepted
+   // Player was accepted, keep the token to resume with
    if(result == 0) {
+      readInt(server, &token[0]);
+      readInt(server, &token[1]);
+      strcpy(playerName, name);
       printf("Player registered\\Signed in\n");
       return 1;
    }
@@ -136,124 +230,295 @@ int sendNamePass(int playersockfd) {
    return -1;
 }
 
-/* Function begins the game and determines which player
-   sequence to enter into to.
+/* Function adds a rankings frame to frame asking for the
+   leaders and the rank of the player.
+*/
+void putRanksFrame(Message *frame, char *name) {
+   putChar(frame, RANKS);
+   putInt(frame, 1);
+   putInt(frame, TOP_RANKS);
+   putInt(frame, strlen(name)+1);
+   putBytes(frame, name, strlen(name)+1);
+}
+
+/* Function receives the leaders and the player's rank and
+   prints them. The frame has no length, so one that cannot
+   be read to its end leaves the rest of the connection
+   unreadable. Returns 0, or -1 if the server is gone or
+   the frame cannot be read to its end.
+*/
+int recvRanks(Reader *server) {
+   int ranked = 0, rank = 0, found = 0;
+   int i, nameSize, wins, losses, ties, rating;
+   char name[21];
+
+   if(readInt(server, &ranked) == -1 || readInt(server, &rank) == -1
+      || readInt(server, &found) == -1) {
+      return -1;
+   }
+   // Server sent more leaders than were asked for
+   if(found < 0 || found > TOP_RANKS) { return -1; }
+   printf("Top players:\n");
+   for(i = 0; i < found; i++) {
+      // Server is gone or the name is larger than a record holds
+      if(readInt(server, &nameSize) == -1 || nameSize < 1 || nameSize > 21
+         || readBytes(server, name, nameSize) == -1) {
+         return -1;
+      }
+      name[nameSize - 1] = '\0';
+      if(readInt(server, &wins) == -1 || readInt(server, &losses) == -1
+         || readInt(server, &ties) == -1 || readInt(server, &rating) == -1) {
+         return -1;
+      }
+      printf("%d. %s: %dW/%dL/%dT, rating %d\n", i + 1, name, wins, losses,
+             ties, rating);
+   }
+   // Player has played before
+   if(rank > 0) { printf("Your rank: %d of %d\n\n", rank, ranked); }
+   else { printf("%d players ranked\n\n", ranked); }
+   return 0;
+}
+
+/* Function begins the game on a board of the size the
+   server plays and plays it from the first turn. Returns 0
+   once the game is over and -1 if it could not be played
+   out.
 */
-void playGame(int playersockfd) {
+int playGame(Reader *server) {
    int playerNum = -1;
-   recv(playersockfd, &playerNum, sizeof(int), 0);
-   recvNames(playersockfd);
-   
-   // If player goes first and is an X on board
-   if(playerNum == 1) {
-      player1(playersockfd);
+   int size = 0, run = 0;
+   Board board;
+
+   // Connection dropped before the game started
+   if(readInt(server, &playerNum) == -1) {
+      return playTurns(server, &board, resumeGame(server, &board));
    }
+   readInt(server, &size);
+   readInt(server, &run);
+   // Server sent a board this player cannot hold
+   if(size < 1 || size > MAX_SIDE) { return -1; }
+   initBoard(&board, size, run);
+   printf("Board is %d x %d, %d in a row wins\n", size, size, run);
+   recvNames(server);
    
-   // If player goes last and is an 0 on board
-   else if(playerNum == 2) {
-      player2(playersockfd);
-   }   
+   // Player 1 is an X on board and goes first, player 2 goes last
+   return playTurns(server, &board, playerNum == 1 ? YOUR_TURN : THEIR_TURN);
 }
 
 /* Function receives the name of player
    and the name of opponent and prints it.
 */
-void recvNames(int playersockfd) {
+void recvNames(Reader *server) {
    int nameSize, opNameSize;
    char name[21];
    char opName[21];
  
-   recv(playersockfd, &nameSize, sizeof(int), 0);
-   recv(playersockfd, name, nameSize, 0);
-   recv(playersockfd, &opNameSize, sizeof(int), 0);
-   recv(playersockfd, opName, opNameSize, 0);
+   readInt(server, &nameSize);
+   readBytes(server, name, nameSize);
+   readInt(server, &opNameSize);
+   readBytes(server, opName, opNameSize);
    
    printf("Your name: %s, Opponent name: %s\n", name, opName);
 }
 
-/* The execution of player 1 or the first player
-   to connect to the server. Makes move first
-   and receives updates from its moves and the
-   moves of player 2.
+/* Function plays turns, starting with the given one, until
+   the game is over, resuming it whenever the connection
+   drops. Returns 0 once the game is over and -1 if it
+   could not be resumed.
 */
-void player1(int playersockfd) {
+int playTurns(Reader *server, Board *board, int turn) {
    int gameStat = -1; // Game not over while -1
+
+   // Continue until the game is declared over
+   while(turn >= 0) {
+      if(turn == YOUR_TURN || turn == YOUR_MOVE) {
+         gameStat = yourTurn(server, board, turn == YOUR_TURN);
+      }
+      else { gameStat = theirTurn(server, board, turn == THEIR_TURN); }
+      // Connection dropped, go on from where the server is
+      if(gameStat == LOST) {
+         turn = resumeGame(server, board);
+         continue;
+      }
+      checkGameStat(server, gameStat);
+      // If game is over after this move
+      if(gameStat != -1) { return 0; }
+      turn = turn == YOUR_TURN || turn == YOUR_MOVE ? THEIR_TURN : YOUR_TURN;
+   }
+   return -1;
+}
+
+/* Function plays the player's turn: a chat first if they
+   may still chat and choose to, then their move. Returns the
+   game status after the move, or LOST.
+*/
+int yourTurn(Reader *server, Board *board, int mayChat) {
    char sendChatOption = 'M';
-   
-   // Player 1 makes move until game declared over
-   // and break statement is reached
-   while(1) {
-      printf("Your turn\n");
-      printf("Enter 'M' to make a move or 'C' to send opponent chat first\n");
-      scanf("%s", &sendChatOption);
-      send(playersockfd, &sendChatOption, sizeof(char), 0);
-      if(sendChatOption == CHAT) { sendChat(playersockfd); }
-      printf("Make move:\n");
-      makeMove(playersockfd);
-      gameStat = recvUpdate(playersockfd);
-      checkGameStat(playersockfd, gameStat);     
-      // If game is over, after player 1's move
-      if(gameStat != -1) { break; }
-      
-      printf("Opponent's turn\n");
-      recv(playersockfd, &sendChatOption, sizeof(char), 0);
-      if(sendChatOption == CHAT) { recvChat(playersockfd); }
-      gameStat = recvUpdate(playersockfd);
-      checkGameStat(playersockfd, gameStat);    
-      // If game is over, after player 2's move
-      if(gameStat != -1) { break; }
+   Message turn;      // Chat option, chat, and move sent together
+
+   printf("Your turn\n");
+   initMessage(&turn);
+   if(mayChat) {
+      // Bot never chats
+      if(!bot) {
+         printf("Enter 'M' to make a move or 'C' to send opponent chat "
+                "first\n");
+         scanf(" %c", &sendChatOption);
+      }
+      putChar(&turn, sendChatOption);
+      if(sendChatOption == CHAT) { sendChat(server, &turn); }
    }
+   printf("Make move:\n");
+   // Server is gone before answering the move
+   if(makeMove(server, board, &turn) == -1) { return LOST; }
+   return recvUpdate(server, board);
 }
 
-/* The execution of player 2 or the second player
-   to connect to the server. Makes move second
-   and receives updates from player 1's moves and
-   its own moves.
+/* Function waits through the opponent's turn: their chat if
+   they may still send one, then their move. Returns the
+   game status after the move, or LOST.
 */
-void player2(int playersockfd) {
-   int gameStat = -1; // Game not over while -1
+int theirTurn(Reader *server, Board *board, int mayChat) {
    char sendChatOption = 'M';
-   
-   // Player 2 makes move until game declared over
-   // and brek statement is reached
-   while(1) {
-      printf("Opponent's turn\n");
-      recv(playersockfd, &sendChatOption, sizeof(char), 0);
-      if(sendChatOption == CHAT) { recvChat(playersockfd); }
-      gameStat = recvUpdate(playersockfd);
-      checkGameStat(playersockfd, gameStat);
-      // If game is over after player 1's move
-      if(gameStat != -1) { break; }
-
-      printf("Your turn\n");
-      printf("Enter 'M' to make a move or 'C' to send opponent chat first\n");
-      scanf("%s", &sendChatOption);
-      send(playersockfd, &sendChatOption, sizeof(char), 0);
-      if(sendChatOption == CHAT) { sendChat(playersockfd); }
-      printf("Make move:\n");      
-      makeMove(playersockfd);
-      gameStat = recvUpdate(playersockfd);
-      checkGameStat(playersockfd, gameStat);
-      // If game is over after player 2's move
-      if(gameStat != -1) { break; }
+
+   printf("Opponent's turn\n");
+   if(mayChat) {
+      // Server is gone before the opponent chose
+      if(readBytes(server, &sendChatOption, sizeof(char)) == -1) {
+         return LOST;
+      }
+      if(sendChatOption == CHAT) { recvChat(server); }
    }
+   return recvUpdate(server, board);
 }
 
-void sendChat(int playersockfd) {
-    char *message = (char *)malloc(sizeof(char) * 200);
+/* Function reconnects once the connection to the server
+   dropped and resumes the game with the token given at
+   login, trying once a second until the server answers.
+   The board is replaced by the server's. Returns whose
+   turn it is, or -1 if the game cannot be resumed.
+*/
+int resumeGame(Reader *server, Board *board) {
+   int sockfd = -1, tries, result = -1;
+   int playerNum = 0, size = 0, run = 0, turn = -1;
+   Message frame;
+
+   printf("Connection lost, reconnecting\n");
+   close(server->fd);
+   for(tries = 0; tries < RESUME_TRIES && sockfd == -1; tries++) {
+      // Wait before every try after the first
+      if(tries > 0) { sleep(1); }
+      sockfd = get_server_connection(serverHost, serverPort);
+   }
+   // Server could not be reached again
+   if(sockfd == -1) {
+      printf("Could not reconnect\n");
+      return -1;
+   }
+   initReader(server, sockfd);
+
+   // Frame type, token, and name size, then name
+   initMessage(&frame);
+   putChar(&frame, RESUME);
+   putInt(&frame, token[0]);
+   putInt(&frame, token[1]);
+   putInt(&frame, strlen(playerName)+1);
+   putBytes(&frame, playerName, strlen(playerName)+1);
+   sendMessage(sockfd, &frame);
+   readInt(server, &result);
+   // Game is over or was abandoned
+   if(result != 0) {
+      printf("Game could not be resumed\n");
+      return -1;
+   }
+   readInt(server, &playerNum);
+   readInt(server, &size);
+   readInt(server, &run);
+   readInt(server, &turn);
+   // Server sent a board this player cannot hold
+   if(size < 1 || size > MAX_SIDE) { return -1; }
+   initBoard(board, size, run);
+   printf("Game resumed as player %d\n", playerNum);
+   // Server is gone again before sending the board
+   if(recvBoard(server, board) == -1) { return -1; }
+   return turn;
+}
+
+/* Function watches a live game by id: the names of its
+   players, then the board after every move until the game
+   is over.
+*/
+void watchGame(Reader *server, int gameId) {
+   int result = -1, size = 0, run = 0, moves = 0, nameSize = 0;
+   char nameX[21], nameO[21];
+   Message frame;
+   Board board;
+
+   // Frame type, game id, and two unused sizes
+   initMessage(&frame);
+   putChar(&frame, WATCH);
+   putInt(&frame, gameId);
+   putInt(&frame, 0);
+   putInt(&frame, 0);
+   sendMessage(server->fd, &frame);
+   readInt(server, &result);
+   // Game is over or was never started
+   if(result != 0) {
+      printf("Game %d is not being played\n", gameId);
+      return;
+   }
+   readInt(server, &gameId);
+   readInt(server, &size);
+   readInt(server, &run);
+   // Server sent a board this spectator cannot hold
+   if(size < 1 || size > MAX_SIDE) { return; }
+   initBoard(&board, size, run);
+   readInt(server, &nameSize);
+   readBytes(server, nameX, nameSize);
+   readInt(server, &nameSize);
+   readBytes(server, nameO, nameSize);
+   printf("Watching game %d, %s as X and %s as O\n", gameId, nameX, nameO);
+   printf("Board is %d x %d, %d in a row wins\n", size, size, run);
+   // Continue until the game is over or the server is gone
+   do {
+      if(readInt(server, &moves) == -1 || readInt(server, &result) == -1
+         || recvBoard(server, &board) == -1) {
+         printf("Connection lost\n");
+         return;
+      }
+      printf("After %d moves\n", moves);
+   } while(result == PLAYING);
+
+   // Result is as the server journals it
+   if(result == 1) { printf("X won\n"); }
+   else if(result == 2) { printf("O won\n"); }
+   else if(result == 3) { printf("Draw\n"); }
+   else { printf("Game abandoned\n"); }
+}
+
+/* Function adds a chat message to the chat option already
+   in msg and sends them to the server together.
+*/
+void sendChat(Reader *server, Message *msg) {
+    char *message = (char *)malloc(sizeof(char) * 201);
     printf("Enter 200 character or less message for opponent:\n");
-    scanf(" %[^\n]s", message);
+    scanf(" %200[^\n]", message);
     int messageSize = strlen(message);
-    send(playersockfd, &messageSize, sizeof(int), 0);
-    send(playersockfd, message, messageSize, 0);
+    putInt(msg, messageSize);
+    putBytes(msg, message, messageSize);
+    sendMessage(server->fd, msg);
+    initMessage(msg);
     free(message);
 }
 
-void recvChat(int playersockfd) {
-    char *message = (char *)malloc(sizeof(char) * 200);
+void recvChat(Reader *server) {
+    char *message = (char *)malloc(sizeof(char) * 201);
     int messageSize = 0;
-    recv(playersockfd, &messageSize, sizeof(int), 0);
-    recv(playersockfd, message, messageSize, 0);
+    readInt(server, &messageSize);
+    // Message larger than the server allows
+    if(messageSize < 0 || messageSize > 200) { messageSize = 0; }
+    readBytes(server, message, messageSize);
+    message[messageSize] = '\0';
     printf("Message received from opponent:\n");
     printf("%s\n", message);
     free(message);
@@ -261,18 +526,19 @@ void recvChat(int playersockfd) {
 
 /* Function receives and returns updated game status after
    a move and calls function to receive the updated board.
+   Returns LOST if the server is gone.
 */
-int recvUpdate(int playersockfd) {
+int recvUpdate(Reader *server, Board *board) {
    int gameStat = -1;
-   recv(playersockfd, &gameStat, sizeof(int), 0);
-   recvBoard(playersockfd);
+   if(readInt(server, &gameStat) == -1) { return LOST; }
+   if(recvBoard(server, board) == -1) { return LOST; }
    return gameStat;
 }
 
 /* Function prints whether the game is over in a win, loss,
    or a draw for associated player.
 */
-void checkGameStat(int playersockfd, int gameStat) {
+void checkGameStat(Reader *server, int gameStat) {
 
    // If player has lost the game
    if(gameStat == 0) {
@@ -291,30 +557,36 @@ void checkGameStat(int playersockfd, int gameStat) {
 }
 
 /* Function makes a move for player by sending specified
-   coordinates to the server.
+   coordinates to the server, together with whatever is
+   already in msg. Returns 0 once the move was taken and -1
+   if the server is gone.
 */
-void makeMove(int playersockfd) {
+int makeMove(Reader *server, Board *board, Message *msg) {
    int x,y,taken;
       
    // Continue until untaken location is sent
    // and break statement is reached
    while(1) {
-      scanf("%d,%d", &x, &y);
+      if(bot) { chooseMove(board, &x, &y); }
+      else { scanf("%d,%d", &x, &y); }
       
       // If coordinates go beyond board boundary
-      if((x < 0 || x > 2) || (y < 0 || y > 2)) {
+      if(!onBoard(board, x, y)) {
          printf("Invalid location choose again\n");
       }
       
       // Coordinates are on the board
       else {
-         send(playersockfd, &x, sizeof(int), 0);
-         send(playersockfd, &y, sizeof(int), 0);
-         recv(playersockfd, &taken, sizeof(int), 0);
+         putInt(msg, x);
+         putInt(msg, y);
+         sendMessage(server->fd, msg);
+         initMessage(msg);
+         // Server is gone, stop asking for moves
+         if(readInt(server, &taken) == -1) { return -1; }
          
          // If location is not taken
          if(taken == 1) {        
-            break;
+            return 0;
          }
          
          // Location is taken
@@ -325,28 +597,34 @@ void makeMove(int playersockfd) {
    }
 }
 
-/* Function receives the updated board from the server
-   and prints it.
+/* Function chooses a random free cell for the bot and
+   prints it as a player would have typed it.
 */
-void recvBoard(int playersockfd) {
-   char *board;
-   char val;
-   recv(playersockfd, board, 10, 0);
-   
-   // Prints the board
-   for(int i = 0; i < 3; i++) {
-      for(int j = 0; j < 3; j++) {
-         val = getSymbolAtBoardLoc(board, i, j);
-         printf("%c ", val);       
+void chooseMove(Board *board, int *x, int *y) {
+   int free = 0, cell, pick;
+
+   for(cell = 0; cell < board->size * board->size; cell++) {
+      free += isTaken(board, cell / board->size, cell % board->size);
+   }
+   // Board is full, the server will say so
+   pick = free > 0 ? rand() % free : 0;
+   for(cell = 0; cell < board->size * board->size - 1; cell++) {
+      if(isTaken(board, cell / board->size, cell % board->size)
+         && pick-- == 0) {
+         break;
       }
-      printf("\n");
    }
-   printf("\n");
+   *x = cell / board->size;
+   *y = cell % board->size;
+   printf("%d,%d\n", *x, *y);
 }
 
-/* Function gets the symbol at given 
-   location on the board.
+/* Function receives the updated board from the server
+   and prints it. Returns 0 on success and -1 if the server
+   is gone.
 */
-char getSymbolAtBoardLoc(char *board, int i, int j) {
-   return board[i*3 + j];
+int recvBoard(Reader *server, Board *board) {
+   if(readBoard(server, board) == -1) { return -1; }
+   printBoard(board);
+   return 0;
 }
@@ -0,0 +1,242 @@
+/*
+This module is the fixed-size pool of game workers. The
+number of threads is set once at start up and never
+grows with the number of games. Sessions are queued on
+the workers in turn, each worker adopts the sessions on
+its own queue after every batch of events, and a worker
+with an empty queue steals the newest session from
+another worker. A session queued on a worker in the
+middle of a batch also wakes a worker waiting for events,
+which steals it, so no session waits on a busy one.
+*/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/eventfd.h>
+#include "pool.h"
+
+void *workerThread(void *ptr);
+void wakeWorker(Connection *conn, int events);
+void wakeIdlePeer(WorkerPool *pool, Worker *busy);
+void adoptSessions(void *arg);
+void pushSession(RunQueue *queue, QueuedSession *item);
+int popOldest(RunQueue *queue, QueuedSession *item);
+int popNewest(RunQueue *queue, QueuedSession *item);
+void startQueued(Worker *worker, QueuedSession *item);
+long monotonicNs(void);
+
+/* Function creates the pool and starts its workers, pinning
+   worker i to CPU i if pin is set.
+*/
+WorkerPool *createPool(int size, int pin, SessionStart start) {
+   WorkerPool *pool = (WorkerPool*)calloc(1, sizeof(WorkerPool));
+   Worker *worker;
+   Connection *wake;
+   cpu_set_t cpus;
+   int i, ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+
+   pool->workers = (Worker*)calloc(size, sizeof(Worker));
+   pool->size = size;
+   pool->start = start;
+   for(i = 0; i < size; i++) {
+      worker = &pool->workers[i];
+      worker->id = i;
+      worker->pool = pool;
+      worker->reactor = createReactor();
+      worker->wakefd = eventfd(0, EFD_NONBLOCK);
+      // Worker could not be set up
+      if(worker->reactor == NULL || worker->wakefd == -1) { return NULL; }
+      pthread_mutex_init(&worker->queue.lock, NULL);
+      wake = addConnection(worker->reactor, worker->wakefd, wakeWorker,
+                           worker);
+      watchInput(wake, 1);
+      setBatchHook(worker->reactor, adoptSessions, worker, -1);
+      pthread_create(&worker->thread, NULL, workerThread, worker);
+      // Keep each worker on its own CPU
+      if(pin) {
+         CPU_ZERO(&cpus);
+         CPU_SET(i % ncpu, &cpus);
+         pthread_setaffinity_np(worker->thread, sizeof(cpu_set_t), &cpus);
+      }
+   }
+   return pool;
+}
+
+/* Thread function runs the worker's event loop.
+*/
+void *workerThread(void *ptr) {
+   Worker *worker = (Worker*) ptr;
+   return runReactor(worker->reactor);
+}
+
+/* Function queues a session on the next worker in turn and
+   wakes that worker. If it is in the middle of a batch, a
+   worker waiting for events is woken as well to steal it.
+*/
+void submitSession(WorkerPool *pool, void *session) {
+   Worker *worker = &pool->workers[atomic_fetch_add(&pool->next, 1)
+                                   % pool->size];
+   QueuedSession item;
+   uint64_t one = 1;
+
+   item.session = session;
+   item.queuedAt = monotonicNs();
+   atomic_fetch_add(&pool->depth, 1);
+   atomic_fetch_add(&pool->submitted, 1);
+   pthread_mutex_lock(&worker->queue.lock);
+   pushSession(&worker->queue, &item);
+   pthread_mutex_unlock(&worker->queue.lock);
+   write(worker->wakefd, &one, sizeof(one));
+   // Worker is busy, have one that is not take the session
+   if(!isWaiting(worker->reactor)) { wakeIdlePeer(pool, worker); }
+}
+
+/* Function wakes one worker other than the busy one which
+   is waiting for events and was not woken to steal already,
+   so sessions queued together wake different workers.
+*/
+void wakeIdlePeer(WorkerPool *pool, Worker *busy) {
+   Worker *peer;
+   uint64_t one = 1;
+   int i, woken;
+
+   for(i = 1; i < pool->size; i++) {
+      peer = &pool->workers[(busy->id + i) % pool->size];
+      woken = 0;
+      if(isWaiting(peer->reactor)
+         && atomic_compare_exchange_strong(&peer->woken, &woken, 1)) {
+         write(peer->wakefd, &one, sizeof(one));
+         return;
+      }
+   }
+}
+
+/* Event handler called when a session was queued on the
+   worker. Sessions are adopted once the batch is done.
+*/
+void wakeWorker(Connection *conn, int events) {
+   uint64_t count;
+   read(conn->fd, &count, sizeof(count));
+}
+
+/* Batch hook adopts every session on the worker's own queue,
+   then steals one session from the first worker still holding
+   any. The worker may be woken to steal again afterwards.
+*/
+void adoptSessions(void *arg) {
+   Worker *worker = (Worker*) arg;
+   WorkerPool *pool = worker->pool;
+   QueuedSession item;
+   int i, got;
+
+   // Take own sessions oldest first
+   while(1) {
+      pthread_mutex_lock(&worker->queue.lock);
+      got = popOldest(&worker->queue, &item);
+      pthread_mutex_unlock(&worker->queue.lock);
+      if(!got) { break; }
+      startQueued(worker, &item);
+   }
+   // Own queue is empty, help workers that are behind
+   for(i = 1; i < pool->size; i++) {
+      Worker *victim = &pool->workers[(worker->id + i) % pool->size];
+      pthread_mutex_lock(&victim->queue.lock);
+      got = popNewest(&victim->queue, &item);
+      pthread_mutex_unlock(&victim->queue.lock);
+      if(got) {
+         atomic_fetch_add(&pool->stolen, 1);
+         startQueued(worker, &item);
+         break;
+      }
+   }
+   atomic_store(&worker->woken, 0);
+}
+
+/* Function records how long a session waited and starts it
+   on the worker.
+*/
+void startQueued(Worker *worker, QueuedSession *item) {
+   WorkerPool *pool = worker->pool;
+   long waited = monotonicNs() - item->queuedAt;
+   long max = atomic_load(&pool->maxWaitNs);
+
+   atomic_fetch_sub(&pool->depth, 1);
+   atomic_fetch_add(&pool->waitNs, waited);
+   // Raise the longest wait unless another worker raised it further
+   while(waited > max
+         && !atomic_compare_exchange_weak(&pool->maxWaitNs, &max, waited)) {}
+   pool->start(worker->reactor, item->session);
+}
+
+/* Function adds a session to the back of a run queue.
+*/
+void pushSession(RunQueue *queue, QueuedSession *item) {
+   QueuedSession *items;
+   int i;
+
+   // Grow ring, unwrapping it into the new array
+   if(queue->count == queue->cap) {
+      int cap = queue->cap == 0 ? 16 : queue->cap * 2;
+      items = (QueuedSession*)malloc(sizeof(QueuedSession) * cap);
+      for(i = 0; i < queue->count; i++) {
+         items[i] = queue->items[(queue->head + i) % queue->cap];
+      }
+      free(queue->items);
+      queue->items = items;
+      queue->head = 0;
+      queue->cap = cap;
+   }
+   queue->items[(queue->head + queue->count) % queue->cap] = *item;
+   queue->count++;
+}
+
+/* Function takes the session at the front of a run queue.
+   Returns 0 if the queue is empty.
+*/
+int popOldest(RunQueue *queue, QueuedSession *item) {
+   if(queue->count == 0) { return 0; }
+   *item = queue->items[queue->head];
+   queue->head = (queue->head + 1) % queue->cap;
+   queue->count--;
+   return 1;
+}
+
+/* Function takes the session at the back of a run queue.
+   Returns 0 if the queue is empty.
+*/
+int popNewest(RunQueue *queue, QueuedSession *item) {
+   if(queue->count == 0) { return 0; }
+   queue->count--;
+   *item = queue->items[(queue->head + queue->count) % queue->cap];
+   return 1;
+}
+
+/* Function prints the pool's queue depth and wait times.
+*/
+void printPoolStats(WorkerPool *pool) {
+   long submitted = atomic_load(&pool->submitted);
+   long depth = atomic_load(&pool->depth);
+   long started = submitted - depth;
+
+   printf("Pool: %d workers, %ld sessions, %ld queued, %ld stolen\n",
+          pool->size, submitted, depth, atomic_load(&pool->stolen));
+   printf("Pool wait: avg %.1f us, max %.1f us\n\n",
+          started > 0 ? atomic_load(&pool->waitNs) / 1000.0 / started : 0.0,
+          atomic_load(&pool->maxWaitNs) / 1000.0);
+}
+
+/* Function gets the time on the monotonic clock in
+   nanoseconds.
+*/
+long monotonicNs(void) {
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return now.tv_sec * 1000000000L + now.tv_nsec;
+}
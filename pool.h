@@ -0,0 +1,59 @@
+/*
+This module is the fixed-size pool of game workers. Each
+worker runs its own event loop and adopts game sessions
+from its run queue, stealing from the other workers'
+queues once its own is empty.
+*/
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "reactor.h"
+
+typedef struct WORKERPOOL WorkerPool;
+
+// Called on the adopting worker's thread to start a session
+typedef void (*SessionStart)(Reactor *reactor, void *session);
+
+typedef struct QUEUEDSESSION {
+   void *session;
+   long queuedAt;          // Nanoseconds on the monotonic clock
+}  QueuedSession;
+
+typedef struct RUNQUEUE {
+   pthread_mutex_t lock;
+   QueuedSession *items;   // Ring of sessions waiting to be adopted
+   int head;
+   int count;
+   int cap;
+}  RunQueue;
+
+typedef struct WORKER {
+   int id;
+   pthread_t thread;
+   Reactor *reactor;
+   int wakefd;             // eventfd written when a session is queued
+   atomic_int woken;       // 1 once woken to steal, until its next batch ends
+   RunQueue queue;
+   WorkerPool *pool;
+}  Worker;
+
+struct WORKERPOOL {
+   Worker *workers;
+   int size;
+   SessionStart start;
+   atomic_uint next;       // Worker the next session is queued on
+   atomic_long depth;      // Sessions queued but not yet adopted
+   atomic_long submitted;
+   atomic_long stolen;     // Sessions adopted from another worker's queue
+   atomic_long waitNs;     // Total time sessions spent queued
+   atomic_long maxWaitNs;
+};
+
+WorkerPool *createPool(int size, int pin, SessionStart start);
+void submitSession(WorkerPool *pool, void *session);
+void printPoolStats(WorkerPool *pool);
+
+#endif
@@ -0,0 +1,315 @@
+/*
+This module is the event loop of the server. A single
+thread waits on epoll for every registered socket and
+calls the handler of the connection which became ready.
+Connections never block: input is read in large chunks
+and handed out field by field, and output the socket
+cannot take yet is kept until it can.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include "reactor.h"
+
+#define MAX_EVENTS 256
+
+struct REACTOR {
+   int epfd;
+   Connection *graveyard; // Connections closed during the current batch
+   BatchHook hook;        // Called after every batch of events
+   void *hookArg;
+   int tickMs;            // Longest wait before hook is called anyway
+   int stopped;           // 1 once the loop should return
+   atomic_int waiting;    // 1 while blocked waiting for events
+};
+
+void updateInterest(Connection *conn);
+void flushOutput(Connection *conn);
+void finishClose(Connection *conn);
+
+/* Function creates the epoll instance used to watch
+   every connection.
+*/
+Reactor *createReactor(void) {
+   Reactor *reactor = (Reactor*)malloc(sizeof(Reactor));
+   reactor->epfd = epoll_create1(0);
+   reactor->graveyard = NULL;
+   reactor->hook = NULL;
+   reactor->tickMs = -1;
+   reactor->stopped = 0;
+   atomic_init(&reactor->waiting, 0);
+   // epoll could not be created
+   if(reactor->epfd == -1) {
+      free(reactor);
+      return NULL;
+   }
+   return reactor;
+}
+
+/* Thread function waits for sockets to become ready and
+   dispatches them until the server is stopped or the loop
+   is told to stop.
+*/
+void *runReactor(void *ptr) {
+   Reactor *reactor = (Reactor*) ptr;
+   struct epoll_event events[MAX_EVENTS];
+   Connection *conn;
+   int i, count;
+
+   while(!reactor->stopped) {
+      atomic_store(&reactor->waiting, 1);
+      count = epoll_wait(reactor->epfd, events, MAX_EVENTS, reactor->tickMs);
+      atomic_store(&reactor->waiting, 0);
+      // Interrupted by a signal, wait again
+      if(count == -1) { continue; }
+      for(i = 0; i < count; i++) {
+         conn = (Connection*) events[i].data.ptr;
+         // Connection was closed earlier in this batch
+         if(conn->fd == -1) { continue; }
+         // Socket can take more of the pending output
+         if(events[i].events & EPOLLOUT) { flushOutput(conn); }
+         // Handler is told about input, hang ups, and errors, and
+         // about room for output it is waiting to send itself
+         if(conn->handler != NULL
+            && ((conn->reading && (events[i].events
+                                   & (EPOLLIN|EPOLLRDHUP|EPOLLHUP|EPOLLERR)))
+                || (conn->writing && (events[i].events & EPOLLOUT)))) {
+            conn->handler(conn, events[i].events);
+         }
+      }
+      // Work gathered during the batch is done all at once
+      if(reactor->hook != NULL) { reactor->hook(reactor->hookArg); }
+      // Connections closed by handlers are freed once no event refers to them
+      while(reactor->graveyard != NULL) {
+         conn = reactor->graveyard;
+         reactor->graveyard = conn->next;
+         free(conn->out);
+         free(conn);
+      }
+   }
+   return NULL;
+}
+
+/* Function sets the hook called after every batch of events,
+   and at least every tickMs milliseconds.
+*/
+void setBatchHook(Reactor *reactor, BatchHook hook, void *arg, int tickMs) {
+   reactor->hook = hook;
+   reactor->hookArg = arg;
+   reactor->tickMs = tickMs;
+}
+
+/* Function makes the event loop return once the current
+   batch of events is done. Must be called on the thread
+   running that event loop.
+*/
+void stopReactor(Reactor *reactor) {
+   reactor->stopped = 1;
+}
+
+/* Function tells whether the event loop is blocked waiting
+   for events rather than handling a batch. May be called
+   from any thread.
+*/
+int isWaiting(Reactor *reactor) {
+   return atomic_load(&reactor->waiting);
+}
+
+/* Function makes socket non-blocking and hands it to the
+   event loop. Handler is not called until input is watched,
+   and the socket only joins epoll once an event is wanted.
+*/
+Connection *addConnection(Reactor *reactor, int fd, EventHandler handler,
+                          void *owner) {
+   Connection *conn;
+   int flags = fcntl(fd, F_GETFL, 0);
+
+   // Socket is not open
+   if(flags == -1) { return NULL; }
+   conn = (Connection*)calloc(1, sizeof(Connection));
+   conn->fd = fd;
+   conn->reactor = reactor;
+   conn->handler = handler;
+   conn->owner = owner;
+   initReader(&conn->in, fd);
+   fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+   return conn;
+}
+
+/* Function removes connection from its event loop without
+   closing it, so it can be handed to another event loop.
+*/
+void detachConnection(Connection *conn) {
+   if(conn->events != 0) {
+      epoll_ctl(conn->reactor->epfd, EPOLL_CTL_DEL, conn->fd, NULL);
+   }
+   conn->reactor = NULL;
+   conn->events = 0;
+}
+
+/* Function adds a detached connection to an event loop. Must
+   be called on the thread running that event loop.
+*/
+void attachConnection(Reactor *reactor, Connection *conn) {
+   conn->reactor = reactor;
+   updateInterest(conn);
+}
+
+/* Function starts or stops telling the handler about input.
+   Input left unwatched stays queued in the socket.
+*/
+void watchInput(Connection *conn, int on) {
+   conn->reading = on;
+   updateInterest(conn);
+}
+
+/* Function starts or stops telling the handler the socket
+   can take more output. Used by owners which keep their own
+   output instead of queuing it on the connection.
+*/
+void watchOutput(Connection *conn, int on) {
+   conn->writing = on;
+   updateInterest(conn);
+}
+
+/* Function registers the events the connection currently
+   needs with epoll. A socket needing none is taken out of
+   epoll, which would otherwise keep reporting its hang up
+   or error to a handler not listening, and is added again
+   once an event is wanted.
+*/
+void updateInterest(Connection *conn) {
+   struct epoll_event event;
+   int wanted = 0, op;
+
+   // Input is wanted until the connection starts closing
+   if(conn->reading && !conn->closing) { wanted |= EPOLLIN | EPOLLRDHUP; }
+   // Output is still waiting to be sent, here or by the handler
+   if(conn->outLen > 0 || (conn->writing && !conn->closing)) {
+      wanted |= EPOLLOUT;
+   }
+   if(wanted == conn->events) { return; }
+
+   event.events = wanted;
+   event.data.ptr = conn;
+   op = wanted == 0 ? EPOLL_CTL_DEL
+        : conn->events == 0 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+   epoll_ctl(conn->reactor->epfd, op, conn->fd, &event);
+   conn->events = wanted;
+}
+
+/* Function takes a field of given size from the connection's
+   input. The socket is only read once the buffered input runs
+   out, and then as much as fits is read at once, so fields a
+   player sends together are received with one call.
+   Returns 1 once the whole field was copied, 0 if more
+   input is needed, and -1 if the peer is gone.
+*/
+int recvField(Connection *conn, void *field, int size) {
+   int got;
+
+   // Field can never fit in the input buffer
+   if(size > READER_SIZE) { return -1; }
+   while(!takeBytes(&conn->in, field, size)) {
+      got = fillReader(&conn->in);
+      // Rest of the field has not arrived yet
+      if(got == 0) { return 0; }
+      if(got < 0) { return -1; }
+   }
+   return 1;
+}
+
+/* Function sends data to the connection. Whatever the
+   socket cannot take now is kept and sent once it can.
+*/
+int sendConn(Connection *conn, const void *data, int size) {
+   int sent = 0;
+
+   // Connection is closing, nothing more may be sent
+   if(conn->closing) { return -1; }
+   // Nothing is queued, so try sending straight away
+   if(conn->outLen == 0) {
+      sent = send(conn->fd, data, size, MSG_NOSIGNAL);
+      if(sent < 0) {
+         // Socket is full, queue the whole message
+         if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            return -1;
+         }
+         sent = 0;
+      }
+      if(sent == size) { return 0; }
+   }
+   // Grow queue to fit the rest of the message
+   if(conn->outLen + size - sent > conn->outCap) {
+      conn->outCap = (conn->outLen + size - sent) * 2;
+      conn->out = (char*)realloc(conn->out, conn->outCap);
+   }
+   memcpy(conn->out + conn->outLen, (const char*)data + sent, size - sent);
+   conn->outLen += size - sent;
+   updateInterest(conn);
+   return 0;
+}
+
+/* Function sends as much queued output as the socket
+   will take.
+*/
+void flushOutput(Connection *conn) {
+   int sent;
+
+   while(conn->outLen > 0) {
+      sent = send(conn->fd, conn->out, conn->outLen, MSG_NOSIGNAL);
+      if(sent < 0) {
+         if(errno == EINTR) { continue; }
+         // Socket is full again, wait for next EPOLLOUT
+         if(errno == EAGAIN || errno == EWOULDBLOCK) { break; }
+         // Peer is gone, output can never be delivered
+         conn->outLen = 0;
+         break;
+      }
+      memmove(conn->out, conn->out + sent, conn->outLen - sent);
+      conn->outLen -= sent;
+   }
+   // Connection was only waiting for its output to be sent
+   if(conn->closing && conn->outLen == 0) {
+      finishClose(conn);
+      return;
+   }
+   updateInterest(conn);
+}
+
+/* Function closes the connection once its queued output has
+   been sent. Handler is never called again.
+*/
+void closeConnection(Connection *conn) {
+   conn->closing = 1;
+   conn->handler = NULL;
+   conn->owner = NULL;
+   // Output still waiting, close after it is sent
+   if(conn->outLen > 0) {
+      updateInterest(conn);
+      return;
+   }
+   finishClose(conn);
+}
+
+/* Function removes socket from epoll, closes it, and
+   frees the connection after the current batch of events.
+*/
+void finishClose(Connection *conn) {
+   Reactor *reactor = conn->reactor;
+   if(conn->events != 0) {
+      epoll_ctl(reactor->epfd, EPOLL_CTL_DEL, conn->fd, NULL);
+   }
+   close(conn->fd);
+   conn->fd = -1;
+   conn->next = reactor->graveyard;
+   reactor->graveyard = conn;
+}
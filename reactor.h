@@ -0,0 +1,51 @@
+/*
+This module is the event loop of the server. It watches
+every player socket with epoll and calls the handler of
+a connection once the socket has input, and it sends any
+output a socket could not take right away once it can.
+Input is buffered so several fields arrive per read.
+*/
+
+#ifndef REACTOR_H
+#define REACTOR_H
+
+#include <sys/epoll.h>
+#include "wire.h"
+
+typedef struct REACTOR Reactor;
+typedef struct CONNECTION Connection;
+typedef void (*EventHandler)(Connection *conn, int events);
+typedef void (*BatchHook)(void *arg);
+
+struct CONNECTION {
+   int fd;
+   Reactor *reactor;
+   EventHandler handler;  // Called on input, room for output, or close
+   void *owner;           // Game or spectator the connection belongs to
+   int reading;           // 1 while the handler wants to be told of input
+   int writing;           // 1 while the handler waits for room for its own output
+   int closing;           // 1 once connection closes after sending output
+   int events;            // Events registered with epoll, 0 while out of it
+   Reader in;             // Bytes received but not yet taken as fields
+   char *out;             // Bytes waiting to be sent
+   int outLen;
+   int outCap;
+   Connection *next;      // Next connection waiting to be freed
+};
+
+Reactor *createReactor(void);
+void *runReactor(void *ptr);
+void setBatchHook(Reactor *reactor, BatchHook hook, void *arg, int tickMs);
+void stopReactor(Reactor *reactor);
+int isWaiting(Reactor *reactor);
+Connection *addConnection(Reactor *reactor, int fd, EventHandler handler,
+                          void *owner);
+void detachConnection(Connection *conn);
+void attachConnection(Reactor *reactor, Connection *conn);
+void watchInput(Connection *conn, int on);
+void watchOutput(Connection *conn, int on);
+int recvField(Connection *conn, void *field, int size);
+int sendConn(Connection *conn, const void *data, int size);
+void closeConnection(Connection *conn);
+
+#endif
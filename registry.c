@@ -0,0 +1,200 @@
+/*
+This module is the registry of every player who has
+logged in. A player's location is their position in
+order of registration. The hash table holds locations
+and is probed linearly from the slot a name hashes to,
+and it doubles once it is 3/4 full so probes stay short.
+Names and passwords never change once a player is added,
+so only the wins, losses, ties, and rating are counted
+atomically.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "registry.h"
+
+unsigned int hashName(char *name);
+void growSlots(Registry *registry, int cap, int placed);
+
+/* Function creates an empty registry.
+*/
+Registry *createRegistry(void) {
+   Registry *registry = (Registry*)calloc(1, sizeof(Registry));
+
+   registry->slotCap = 1024;
+   registry->slots = (int*)malloc(sizeof(int) * registry->slotCap);
+   memset(registry->slots, -1, sizeof(int) * registry->slotCap);
+   pthread_mutex_init(&registry->lock, NULL);
+   return registry;
+}
+
+/* Function gets the record of the player at a location.
+*/
+PlayerEntry *getPlayer(Registry *registry, int loc) {
+   return &registry->blocks[loc >> BLOCK_BITS][loc & (BLOCK_SIZE - 1)];
+}
+
+/* Function gives the number of players registered so far.
+*/
+int countPlayers(Registry *registry) {
+   int count;
+
+   pthread_mutex_lock(&registry->lock);
+   count = registry->count;
+   pthread_mutex_unlock(&registry->lock);
+   return count;
+}
+
+/* Function counts the result of a game for a player and
+   moves their rating. The begun count is raised before and
+   the finished count after, so a reader can tell a result
+   was being counted while it copied.
+*/
+void addResult(Registry *registry, int loc, int won, int lost, int tied,
+               int rated) {
+   PlayerEntry *entry = getPlayer(registry, loc);
+
+   atomic_fetch_add(&entry->begun, 1);
+   if(won) { atomic_fetch_add(&entry->wins, won); }
+   if(lost) { atomic_fetch_add(&entry->losses, lost); }
+   if(tied) { atomic_fetch_add(&entry->ties, tied); }
+   if(rated) { atomic_fetch_add(&entry->rating, rated); }
+   atomic_fetch_add(&entry->finished, 1);
+}
+
+/* Function sets a player's wins, losses, ties, and rating
+   from a record, as when they are loaded.
+*/
+void setResults(Registry *registry, int loc, PlayerRecord *record) {
+   PlayerEntry *entry = getPlayer(registry, loc);
+
+   atomic_fetch_add(&entry->begun, 1);
+   atomic_store(&entry->wins, record->wins);
+   atomic_store(&entry->losses, record->losses);
+   atomic_store(&entry->ties, record->ties);
+   atomic_store(&entry->rating, record->rating);
+   atomic_fetch_add(&entry->finished, 1);
+}
+
+/* Function copies a player's record. The copy is taken again
+   until every result begun had finished when it began and
+   none was begun while it was taken. The finished count is
+   read first, so a result begun between the two reads is
+   seen as still being counted.
+*/
+void copyPlayer(Registry *registry, int loc, PlayerRecord *copy) {
+   PlayerEntry *entry = getPlayer(registry, loc);
+   unsigned short finished, begun;
+
+   strcpy(copy->name, entry->name);
+   strcpy(copy->password, entry->password);
+   while(1) {
+      finished = atomic_load(&entry->finished);
+      begun = atomic_load(&entry->begun);
+      // A result is still being counted
+      if(begun != finished) { continue; }
+      copy->wins = atomic_load(&entry->wins);
+      copy->losses = atomic_load(&entry->losses);
+      copy->ties = atomic_load(&entry->ties);
+      copy->rating = atomic_load(&entry->rating);
+      if(atomic_load(&entry->begun) == begun) { return; }
+   }
+}
+
+/* Function finds a player by name. Returns their location,
+   or -1 if no player has that name. The caller holds the
+   registry's lock.
+*/
+int findPlayer(Registry *registry, char *name) {
+   unsigned int mask = registry->slotCap - 1;
+   unsigned int slot = hashName(name) & mask;
+   int loc;
+
+   // Probe until the name or an empty slot is found
+   while((loc = registry->slots[slot]) != -1) {
+      if(strcmp(getPlayer(registry, loc)->name, name) == 0) { return loc; }
+      slot = (slot + 1) & mask;
+   }
+   return -1;
+}
+
+/* Function adds a copy of a new player's record. Returns
+   the player's location, or -1 if the registry is full.
+   The caller holds the registry's lock.
+*/
+int addPlayer(Registry *registry, PlayerRecord *record) {
+   PlayerEntry *entry;
+   int loc = registry->count;
+   unsigned int mask, slot;
+
+   // Every block is in use
+   if(loc == MAX_BLOCKS * BLOCK_SIZE) { return -1; }
+   // Start a new block when the last one is full
+   if(registry->blocks[loc >> BLOCK_BITS] == NULL) {
+      registry->blocks[loc >> BLOCK_BITS] =
+         (PlayerEntry*)aligned_alloc(CACHE_LINE, BLOCK_SIZE * sizeof(PlayerEntry));
+   }
+   entry = getPlayer(registry, loc);
+   strcpy(entry->name, record->name);
+   strcpy(entry->password, record->password);
+   atomic_init(&entry->wins, record->wins);
+   atomic_init(&entry->losses, record->losses);
+   atomic_init(&entry->ties, record->ties);
+   atomic_init(&entry->rating, record->rating);
+   atomic_init(&entry->begun, 0);
+   atomic_init(&entry->finished, 0);
+   registry->count++;
+
+   // Keep the table at most 3/4 full
+   // Newest player is placed below
+   if(registry->count * 4 > registry->slotCap * 3) {
+      growSlots(registry, registry->slotCap * 2, registry->count - 1);
+   }
+   mask = registry->slotCap - 1;
+   slot = hashName(record->name) & mask;
+   while(registry->slots[slot] != -1) { slot = (slot + 1) & mask; }
+   registry->slots[slot] = loc;
+   return loc;
+}
+
+/* Function sizes the hash table for count more players at
+   once, so loading many players never grows it on the way.
+   The caller holds the registry's lock.
+*/
+void reservePlayers(Registry *registry, int count) {
+   int cap = registry->slotCap;
+
+   while((long) (registry->count + count) * 4 > (long) cap * 3) { cap *= 2; }
+   if(cap > registry->slotCap) { growSlots(registry, cap, registry->count); }
+}
+
+/* Function replaces the hash table with one of cap slots and
+   places the first placed players registered in it.
+*/
+void growSlots(Registry *registry, int cap, int placed) {
+   unsigned int mask, slot;
+   int loc;
+
+   free(registry->slots);
+   registry->slotCap = cap;
+   registry->slots = (int*)malloc(sizeof(int) * registry->slotCap);
+   memset(registry->slots, -1, sizeof(int) * registry->slotCap);
+   mask = registry->slotCap - 1;
+   for(loc = 0; loc < placed; loc++) {
+      slot = hashName(getPlayer(registry, loc)->name) & mask;
+      while(registry->slots[slot] != -1) { slot = (slot + 1) & mask; }
+      registry->slots[slot] = loc;
+   }
+}
+
+/* Function hashes a name with 32-bit FNV-1a.
+*/
+unsigned int hashName(char *name) {
+   unsigned int hash = 2166136261u;
+
+   while(*name != '\0') {
+      hash ^= (unsigned char) *name++;
+      hash *= 16777619u;
+   }
+   return hash;
+}
@@ -0,0 +1,63 @@
+/*
+This module is the registry of every player who has
+logged in. Records are kept in blocks that never move,
+so a player's location stays valid as the registry grows,
+and names are found through an open addressing hash table.
+Results are counted with atomics in entries a cache line
+each, so games finishing together never wait on a lock or
+on a neighbouring player's line, and readers take a copy
+that is retried until no result was counted during it.
+*/
+
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define BLOCK_BITS 12        // 4096 records per block
+#define BLOCK_SIZE (1 << BLOCK_BITS)
+#define MAX_BLOCKS 4096      // Room for 16M players
+#define CACHE_LINE 64
+#define START_RATING 1500    // Rating of a player with no games
+
+typedef struct PLAYERRECORD {
+   char name[21]; // Up to 20 letters
+   char password[21]; // Up to 20 letters
+   int wins;
+   int losses;
+   int ties;
+   int rating;    // Elo rating
+}  PlayerRecord;
+
+typedef struct PLAYERENTRY {
+   _Alignas(CACHE_LINE) char name[21];
+   char password[21];
+   atomic_int wins;
+   atomic_int losses;
+   atomic_int ties;
+   atomic_int rating;
+   atomic_ushort begun;  // Results begun, counted around so the entry fits a line
+   atomic_ushort finished; // Results finished
+}  PlayerEntry;
+
+typedef struct REGISTRY {
+   PlayerEntry *blocks[MAX_BLOCKS]; // Players in order of registration
+   int count;
+   int *slots;          // Location of the player hashed to each slot, -1 if none
+   int slotCap;         // Always a power of two
+   pthread_mutex_t lock; // Guards the hash table and count
+}  Registry;
+
+Registry *createRegistry(void);
+PlayerEntry *getPlayer(Registry *registry, int loc);
+int findPlayer(Registry *registry, char *name);
+int addPlayer(Registry *registry, PlayerRecord *record);
+void reservePlayers(Registry *registry, int count);
+int countPlayers(Registry *registry);
+void addResult(Registry *registry, int loc, int won, int lost, int tied,
+               int rated);
+void setResults(Registry *registry, int loc, PlayerRecord *record);
+void copyPlayer(Registry *registry, int loc, PlayerRecord *copy);
+
+#endif
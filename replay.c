@@ -0,0 +1,110 @@
+/*
+Compile: gcc -O2 -o replay replay.c journal.c board.c wire.c -lpthread
+Run:     ./replay [-c] [-p] [journal directory]
+
+This program reads the journal of games the server
+keeps and counts the games, moves, and results in it
+without the server running. Each game can be played
+again move by move with the same board functions the
+server plays with, to check the recorded result is the
+one the moves lead to (-c), and printed as it is read
+(-p). The journal in the current directory is read
+unless another directory is given.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include "board.h"
+#include "journal.h"
+
+int replayGame(JournalGame *game, int print);
+double clockSeconds(void);
+
+/* Main function which reads every game of the journal and
+   prints the totals and how fast they were read.
+*/
+int main(int argc, char *argv[]) {
+   JournalReader *reader;
+   JournalGame *game;
+   char *dir;
+   int option, check = 0, print = 0, first, last;
+   long games = 0, plies = 0, wrong = 0;
+   long results[DRAWN + 1] = {0};
+   double started, took;
+
+   // Read checking and printing options
+   while((option = getopt(argc, argv, "cp")) != -1) {
+      if(option == 'c') { check = 1; }
+      else if(option == 'p') { print = 1; }
+      else { exit(1); }
+   }
+   dir = optind < argc ? argv[optind] : JOURNAL_DIR;
+   // Journal has no segments, nothing will be read
+   if(findSegments(dir, &first, &last) == 0) {
+      first = 1;
+      last = 0;
+   }
+   reader = openReader(dir, first, last);
+   started = clockSeconds();
+   while((game = nextGame(reader)) != NULL) {
+      games++;
+      plies += game->plies;
+      results[game->result]++;
+      // Moves do not lead to the recorded result
+      if((check || print) && replayGame(game, print) != game->result) {
+         wrong++;
+      }
+   }
+   took = clockSeconds() - started;
+   closeReader(reader);
+
+   printf("%ld games, %ld moves: %ld X won, %ld O won, %ld drawn, "
+          "%ld abandoned\n", games, plies, results[X_WON], results[O_WON],
+          results[DRAWN], results[ABANDONED]);
+   if(check) { printf("%ld games did not end as recorded\n", wrong); }
+   printf("Read in %.3f s, %.0f games/s\n", took,
+          took > 0 ? games / took : 0.0);
+}
+
+/* Function plays a game again from its moves, X first, and
+   prints it if asked to. Returns the result the moves lead
+   to, which is ABANDONED if they stop before the game is over.
+*/
+int replayGame(JournalGame *game, int print) {
+   Board board;
+   char turn = PLAYER1;
+   int ply, cell, result = ABANDONED;
+
+   initBoard(&board, game->size, game->run);
+   for(ply = 0; ply < game->plies; ply++) {
+      cell = gameCell(game, ply);
+      // Move is off the board, on a taken cell, or after the game was over
+      if(cell >= board.size * board.size || result != ABANDONED
+         || !isTaken(&board, cell / board.size, cell % board.size)) {
+         return -1;
+      }
+      markBoard(&board, cell / board.size, cell % board.size, turn);
+      // If this move won or drew the game
+      if(checkWin(&board, turn) == 1) {
+         result = turn == PLAYER1 ? X_WON : O_WON;
+      }
+      else if(checkDraw(&board) == 2) { result = DRAWN; }
+      turn = turn == PLAYER1 ? PLAYER2 : PLAYER1;
+   }
+   if(print) {
+      printf("Players %d and %d, %d moves, result %d\n", game->playerX,
+             game->playerO, game->plies, game->result);
+      printBoard(&board);
+   }
+   return result;
+}
+
+/* Function gets the time on the monotonic clock in seconds.
+*/
+double clockSeconds(void) {
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return now.tv_sec + now.tv_nsec / 1e9;
+}
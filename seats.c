@@ -0,0 +1,99 @@
+/*
+This module keeps the seat of every logged in player in
+a hash table chained by token. Tokens come from the
+kernel's random source, so a token cannot be guessed from
+the tokens of other players, and since they are already
+random their low bits pick the bucket. The table doubles
+once it holds as many seats as buckets.
+*/
+
+#include <stdlib.h>
+#include <sys/random.h>
+#include "seats.h"
+
+void growBuckets(SeatTable *seats);
+
+/* Function creates an empty seat table.
+*/
+SeatTable *createSeats(void) {
+   SeatTable *seats = (SeatTable*)calloc(1, sizeof(SeatTable));
+
+   seats->cap = 1024;
+   seats->buckets = (Seat**)calloc(seats->cap, sizeof(Seat*));
+   pthread_mutex_init(&seats->lock, NULL);
+   return seats;
+}
+
+/* Function gives a logged in player a seat under a new
+   token. The player sits in no game yet.
+*/
+Seat *openSeat(SeatTable *seats, int loc) {
+   Seat *seat = (Seat*)calloc(1, sizeof(Seat));
+   Seat **bucket;
+
+   seat->loc = loc;
+   seat->wakefd = -1;
+   pthread_mutex_lock(&seats->lock);
+   // Draw again on the rare token already given or 0
+   do {
+      getrandom(&seat->token, sizeof(seat->token), 0);
+   } while(seat->token == 0 || findSeat(seats, seat->token) != NULL);
+   bucket = &seats->buckets[seat->token & (seats->cap - 1)];
+   seat->next = *bucket;
+   *bucket = seat;
+   seats->count++;
+   // Keep chains about one seat long
+   if(seats->count > seats->cap) { growBuckets(seats); }
+   pthread_mutex_unlock(&seats->lock);
+   return seat;
+}
+
+/* Function finds the seat given a token. Returns NULL if no
+   seat has that token. The caller holds the table's lock.
+*/
+Seat *findSeat(SeatTable *seats, uint64_t token) {
+   Seat *seat = seats->buckets[token & (seats->cap - 1)];
+
+   while(seat != NULL && seat->token != token) { seat = seat->next; }
+   return seat;
+}
+
+/* Function takes a seat out of the table and frees it.
+   Returns the connection that was waiting to resume in it,
+   NULL if none, for the caller to close.
+*/
+void *closeSeat(SeatTable *seats, Seat *seat) {
+   Seat **link;
+   void *resumed;
+
+   pthread_mutex_lock(&seats->lock);
+   link = &seats->buckets[seat->token & (seats->cap - 1)];
+   while(*link != seat) { link = &(*link)->next; }
+   *link = seat->next;
+   seats->count--;
+   resumed = seat->resumed;
+   pthread_mutex_unlock(&seats->lock);
+   free(seat);
+   return resumed;
+}
+
+/* Function doubles the buckets and chains every seat again.
+   The caller holds the table's lock.
+*/
+void growBuckets(SeatTable *seats) {
+   int cap = seats->cap * 2;
+   Seat **buckets = (Seat**)calloc(cap, sizeof(Seat*));
+   Seat *seat, *next;
+   int i;
+
+   for(i = 0; i < seats->cap; i++) {
+      for(seat = seats->buckets[i]; seat != NULL; seat = next) {
+         next = seat->next;
+         seat->next = buckets[seat->token & (cap - 1)];
+         buckets[seat->token & (cap - 1)] = seat;
+      }
+   }
+   free(seats->buckets);
+   seats->buckets = buckets;
+   seats->cap = cap;
+}
@@ -0,0 +1,39 @@
+/*
+This module keeps the seat of every logged in player. A
+seat is found by the random token the player was given
+at login, so a player whose connection dropped can take
+their seat in a game again from a new connection without
+logging in again.
+*/
+
+#ifndef SEATS_H
+#define SEATS_H
+
+#include <pthread.h>
+#include <stdint.h>
+
+typedef struct SEAT Seat;
+
+struct SEAT {
+   uint64_t token;      // Given to the player at login, never 0
+   int loc;             // Location of player on scoreboard
+   void *game;          // Game the player sits in, NULL until it starts
+   char symbol;         // Player's symbol in the game
+   int wakefd;          // eventfd of the game, written once a player resumes
+   void *resumed;       // Connection waiting to be taken by the game
+   Seat *next;          // Next seat in the same bucket
+};
+
+typedef struct SEATTABLE {
+   Seat **buckets;      // Seats chained by token
+   int cap;             // Always a power of two
+   int count;
+   pthread_mutex_t lock; // Guards the buckets and every seat's game fields
+}  SeatTable;
+
+SeatTable *createSeats(void);
+Seat *openSeat(SeatTable *seats, int loc);
+Seat *findSeat(SeatTable *seats, uint64_t token);
+void *closeSeat(SeatTable *seats, Seat *seat);
+
+#endif
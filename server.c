@@ -2,18 +2,42 @@
 Group:   Nicholas Baranosky, Myles Spencer, Morgan McGuire
 Class:   Operating Systems
 Date:    Oct. 18, 2021
-Compile: gcc -o server server.c server-thread-2021.c -lpthread
-Run:     ./server 17100
+Compile: gcc -o server server.c server-thread-2021.c reactor.c matchmaker.c pool.c wire.c board.c ai.c registry.c storage.c leaderboard.c seats.c journal.c audience.c -lpthread -lm
+Run:     ./server 17100 [-p fifo|rating|named] [-w workers] [-c] [-b size,run]
+         [-d depth] [-t ms] [-a seconds] [-s ms] [-v skip|drop]
    
 This program is the server which hosts
 and controls the board for tic-tac-toe games.
 It accepts connections from many players using
-sockets and hosts multiple games using threads.
+sockets and hosts every login and game on one
+event loop, where each is a state machine advanced
+whenever its player sends data. Logged in players
+wait in a matchmaking lobby until they are paired,
+and each game is then hosted by one of a fixed pool
+of worker threads, optionally pinned to CPUs (-c).
+Games are played on a 3 x 3 board unless another
+size and number in a row to win are given (-b).
+Players who ask for "bot" as their opponent, or who
+wait alone long enough (-a), play the computer, which
+searches up to depth moves ahead (-d) for at most ms
+milliseconds a move (-t) on its own threads.
+Every new player and result is logged to disk as it
+happens and synced at most ms milliseconds later (-s),
+and every game's moves are kept in a journal.
+Before logging in, a player may ask for a page of the
+rankings and their own rank any number of times.
+A player whose connection drops mid-game is given a
+grace period to resume the game from a new connection
+with the token they were given at login.
+Anyone may watch a live game by the id it was started
+under. A spectator who falls behind the game skips ahead
+to the newest board, or is disconnected (-v drop).
 */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
@@ -22,431 +46,1177 @@ sockets and hosts multiple games using threads.
 #include <sys/stat.h>
 #include <netdb.h>
 #include <pthread.h>
+#include <stdint.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 #include "server-thread-2021.h"
+#include "reactor.h"
+#include "matchmaker.h"
+#include "pool.h"
+#include "wire.h"
+#include "board.h"
+#include "ai.h"
+#include "registry.h"
+#include "storage.h"
+#include "leaderboard.h"
+#include "seats.h"
+#include "journal.h"
+#include "audience.h"
 #include <time.h>
+#include <math.h>
 
 #define HOST "freebsd1.cs.scranton.edu"
 #define BACKLOG 10
-#define PLAYER1 'X'
-#define PLAYER2 'O'
-#define EMPTY '-'
 #define CHAT 'C'
 #define MOVE 'M'
+#define MAX_CHAT 200
+#define LOGIN 'L'
+#define RANKS 'R'
+#define RESUME 'S'
+#define WATCH 'W'
+#define MAX_RANKS 10    // Most players sent in one rankings reply
+#define LOGIN_HEADER_SIZE (sizeof(char) + 3 * sizeof(int))
+#define MATCH_TICK 1000 // Milliseconds between matching passes when idle
+#define POOL_REPORT 60  // Seconds between worker pool reports
+#define COMPUTER "bot"  // Name the computer plays under
+#define SEARCH_THREADS 2 // Threads searching for the computer's moves
+#define RATING_K 32     // Most rating points one game can move
+#define GRACE_SECONDS 30 // Longest a game waits for players who left to resume
+#define NO_GAME -3      // Resume or watch reply when there is no such game
+#define PLAYING -1      // Result sent to spectators while the game goes on
 
-typedef struct PLAYERRECORD {
-   char name[21]; // Up to 20 letters
-   char password[21]; // Up to 20 letters
-   int wins;
-   int losses;
-   int ties;
-}  PlayerRecord;
+enum GAMESTATE {
+   AWAIT_CHAT_OPTION,   // Waiting for mover to choose chat or move
+   AWAIT_CHAT_SIZE,     // Waiting for size of mover's chat message
+   AWAIT_CHAT_MESSAGE,  // Waiting for mover's chat message
+   AWAIT_MOVE           // Waiting for coordinates of mover's move
+};
 
-typedef struct LOCK {
-   pthread_mutex_t lock; // Used to protect scoreboard
-}  Lock;
+enum RESUMETURN {
+   THEIR_TURN,          // Opponent moves next and may chat first
+   THEIR_MOVE,          // Opponent's chat was sent, only their move is left
+   YOUR_TURN,           // Player moves next and may chat first
+   YOUR_MOVE            // Player's chat was sent, only their move is left
+};
 
-typedef struct SAVE {
-   PlayerRecord *scoreboard;
-   Lock *mutex;
-   int fd;
-}  Save;
+enum LOGINSTATE {
+   AWAIT_LOGIN_HEADER,  // Waiting for frame type and field sizes
+   AWAIT_LOGIN_BODY     // Waiting for name, password, and opponent
+};
 
 typedef struct GAMECONTEXT {
    int playerXId;            // id of player X
    int playerOId;            // id of player O
    int playerXSockfd;        // sockfd for player X
    int playerOSockfd;        // sockfd for player O
-   PlayerRecord *scoreboard;
-   Lock *mutex;
+   Connection *playerX;      // Event loop connection of player X, NULL while away
+   Connection *playerO;      // Connection of player O, NULL for computer or while away
+   Reactor *reactor;         // Event loop of the worker hosting the game
+   SeatTable *seats;
+   Seat *seatX;              // Seat player X resumes from
+   Seat *seatO;              // Seat player O resumes from, NULL for computer
+   Connection *resumes;      // eventfd written when a player resumes
+   Connection *grace;        // Timer while a player is away, NULL if none
+   char computer;            // Symbol the computer plays, 0 if none
+   SearchPool *search;       // Threads the computer's moves are searched on
+   int searchDepth;
+   int searchBudget;         // Milliseconds the computer may take a move
+   Registry *scoreboard;
+   Storage *storage;         // Log the game's result is appended to
+   Leaderboard *leaders;     // Rankings the players are moved in
+   Journal *journal;         // Journal the game is appended to once over
+   AudienceTable *audiences;
+   Audience *audience;       // Spectators watching the game
+   long long started;        // Milliseconds since the epoch
+   Board board;
+   short cells[MAX_SIDE * MAX_SIDE]; // Cell taken by each move in order
+   char turn;                // Symbol of player whose turn it is
+   int state;                // Part of the turn being waited for
+   char chatOption;
+   int chatSize;
+   char chat[MAX_CHAT];
+   Message toX;              // Output for player X not yet sent
+   Message toO;              // Output for player O not yet sent
 }  GameContext;
 
-void playGame(GameContext *game);
-void makeMove(int playersockfd, char pSymb, char *board);
-char *createBoard(int x, int y);
-void printBoard(char *board);
-int isTaken(char *board, int msgx, int msgy);
-void markBoard(char *board, int msgx, int msgy, char playerSymbol);
-int checkWin(char *board, char playerSymbol);
-int checkDraw(char *board);
-void sendResult(int winner, int loser, int gameStat, char *board);
-void sendUpdate(int p1sockfd, int p2sockfd, int gameStat, char *board);
-int acceptName(PlayerRecord *scoreboard, int playersockfd, Lock *mutex);
-void start_subserver(GameContext *game);
-void *subserver(void *ptr);
+typedef struct SERVER {
+   Reactor *reactor;
+   Registry *scoreboard;
+   Storage *storage;         // Log of new players and results
+   Leaderboard *leaders;     // Every player ranked by rating
+   SeatTable *seats;         // Seat of every logged in player by token
+   Journal *journal;         // Moves of every game played
+   AudienceTable *audiences; // Audience of every live game by id
+   int watchPolicy;          // What happens to spectators who fall behind
+   Lobby *lobby;             // Logged in players waiting to be paired
+   WorkerPool *pool;         // Workers which host the games
+   int boardSize;            // Cells per side of every game's board
+   int boardRun;             // Marks in a row needed to win
+   SearchPool *search;       // Threads the computer's moves are searched on
+   int computerLoc;          // Location of computer on scoreboard, -1 if none
+   int searchDepth;          // Most moves ahead the computer searches
+   int searchBudget;         // Milliseconds the computer may take a move
+   time_t lastReport;        // Time pool stats were last printed
+   long lastSubmitted;       // Games submitted at last report
+}  Server;
+
+typedef struct LOGINCONTEXT {
+   Server *server;
+   int state;                // Part of the login frame being waited for
+   char type;                // Login, rankings, resume, or watch frame
+   uint64_t token;           // Token of the seat being resumed
+   int gameId;               // Game to be watched
+   int first;                // First rank asked for
+   int count;                // Number of ranks asked for
+   int nameSize;
+   int passSize;
+   int oppSize;
+   char body[63];            // Name, password, then requested opponent
+}  LoginContext;
+
+void playGame(Connection *conn, int events);
+int advanceTurn(GameContext *game);
+int makeMove(GameContext *game, Connection *mover);
+int finishMove(GameContext *game);
+void sendResult(Message *winner, Message *loser, int gameStat, Board *board);
+void sendUpdate(GameContext *game, int gameStat);
+void sendMessageTo(Connection *conn, Message *msg);
+void flushMessages(GameContext *game);
+int acceptName(Server *server, char *name, char *password);
+void acceptPlayers(Connection *listener, int events);
+void loginPlayer(Connection *conn, int events);
+int recvLogin(LoginContext *login, Connection *conn);
+void sendRanks(Server *server, Connection *conn, LoginContext *login);
+void resumeSeat(Server *server, Connection *conn, LoginContext *login);
+void refuseResume(Connection *conn);
+void watchGame(Server *server, Connection *conn, LoginContext *login);
+void enterLobby(Server *server, Connection *conn, int loc, Seat *seat,
+                LoginContext *login);
+void waitInLobby(Connection *conn, int events);
+void dispatchMatches(void *arg, Match *matches, int count);
+void runLobby(void *arg);
+void startSession(Reactor *reactor, void *session);
+int playerRating(PlayerRecord *record);
+int ratingChange(int rating, int opponent, int halfPoints);
+void startGame(GameContext *game);
+void startSearch(GameContext *game);
+void computerMoved(Connection *conn, int events);
+void watchMover(GameContext *game, int on);
+void endGame(GameContext *game, int result);
+void abandonGame(GameContext *game);
+void closeGame(GameContext *game);
+void leaveGame(GameContext *game, char symbol);
+void dropPlayer(GameContext *game, char symbol);
+void graceExpired(Connection *conn, int events);
+void gameWoken(Connection *conn, int events);
+void rejoinGame(GameContext *game, char symbol, Connection *conn);
+void admitSpectator(GameContext *game, Spectator *spectator);
+void updateSpectators(GameContext *game, int result);
+void putSpectatorUpdate(Message *msg, GameContext *game, int result);
+int resumeTurn(GameContext *game, char symbol);
 void sendNames(GameContext *game);
 void updateGameContext(GameContext *game, int status);
+void recordGame(GameContext *game, int result);
 void sendGameContext(GameContext *game);
-void sendToPlayer1(GameContext *game);
-void sendToPlayer2(GameContext *game);
-void printScoreboard(GameContext *game);
-void assignXGameContext(GameContext *game, int loc, int playersockfd);
-void assignOGameContext(GameContext *game, int loc, int playersockfd);
-int serverFull(int playersockfd);
-int authenticatePlayer(PlayerRecord *scoreboard, int playersockfd, int loc);
-void setPassword(PlayerRecord *scoreboard, int playersockfd, int loc);
-void acceptPlayer1(GameContext *game, int sockfd);
-void acceptPlayer2(GameContext *game, int sockfd);
-void loadScoreboard(int fd, PlayerRecord *scoreboard);
-PlayerRecord *readRecordAt(int fd, int index);
-void *saveThread(void *args);
-int writeRecordAt(int fd, PlayerRecord *record, int index);
-void startSave(int fd, PlayerRecord *record, Lock *mutex);
-void recvAndSendChat(int sender, int receiver);
-void player1Wins(GameContext *game, char *board, int gameStat);
-void player2Wins(GameContext *game, char *board, int gameStat);
-void draw(GameContext *game, char *board, int gameStat);
-void checkForChat(int sender, int receiver);
-
-/* Main function which accepts player connections
-   and assigns them a status as either player 1 or
-   player 2. Starts the game.
+void sendToPlayer1(GameContext *game, PlayerRecord *x, PlayerRecord *o);
+void sendToPlayer2(GameContext *game, PlayerRecord *x, PlayerRecord *o);
+void printResults(GameContext *game);
+void assignXGameContext(GameContext *game, int loc, Connection *conn);
+void assignOGameContext(GameContext *game, int loc, Connection *conn);
+int serverFull(void);
+int authenticatePlayer(Registry *scoreboard, char *password, int loc);
+void setPassword(Registry *scoreboard, char *password, int loc);
+void player1Wins(GameContext *game, Board *board, int gameStat);
+void player2Wins(GameContext *game, Board *board, int gameStat);
+void draw(GameContext *game, Board *board, int gameStat);
+
+/* Main function which starts the server and runs
+   the event loop that logs players in, pairs them
+   as player 1 and player 2, and hosts their games.
 */
 int main(int argc, char *argv[]) {
-   int sockfd, fd;   
+   int sockfd, option, loc;
+   MatchPolicy policy = fifoPolicy;
+   int workers = sysconf(_SC_NPROCESSORS_ONLN);
+   int pin = 0;
+   int size = 3, run = 3;
+   int depth = 9, budget = 500, soloAfter = 0, syncMs = 0;
+   int watchPolicy = SKIP_AHEAD;
    
+   // Read matchmaking, pool, board, computer, logging, and spectator options
+   while((option = getopt(argc, argv, "p:w:cb:d:t:a:s:v:")) != -1) {
+      if(option == 'p' && (policy = findPolicy(optarg)) == NULL) {
+         printf("Unknown matchmaking policy\n");
+         exit(1);
+      }
+      else if(option == 'w' && (workers = atoi(optarg)) < 1) {
+         printf("Pool needs at least one worker\n");
+         exit(1);
+      }
+      else if(option == 'c') { pin = 1; }
+      else if(option == 'b' && (sscanf(optarg, "%d,%d", &size, &run) != 2
+              || size < 3 || size > MAX_SIDE || run < 3 || run > size)) {
+         printf("Board must be 3 to %d cells a side with 3 to size in a row\n",
+                MAX_SIDE);
+         exit(1);
+      }
+      else if((option == 'd' && (depth = atoi(optarg)) < 1)
+              || (option == 't' && (budget = atoi(optarg)) < 1)
+              || (option == 'a' && (soloAfter = atoi(optarg)) < 0)) {
+         printf("Computer needs a depth and time of at least 1\n");
+         exit(1);
+      }
+      else if(option == 's' && (syncMs = atoi(optarg)) < 0) {
+         printf("Log sync time cannot be negative\n");
+         exit(1);
+      }
+      else if(option == 'v') {
+         if(strcmp(optarg, "skip") == 0) { watchPolicy = SKIP_AHEAD; }
+         else if(strcmp(optarg, "drop") == 0) { watchPolicy = DROP_SLOW; }
+         else {
+            printf("Slow spectators are either skipped ahead or dropped\n");
+            exit(1);
+         }
+      }
+      else if(option == '?') { exit(1); }
+   }
    // Program was run without port
-   if(argc != 2) {
+   if(optind != argc - 1) {
       printf("No program port\n");
       exit(1);
    }
-   sockfd = start_server(HOST, argv[1], BACKLOG); 
+   sockfd = start_server(HOST, argv[optind], BACKLOG); 
    // Could not establish server connection
    if(sockfd == -1) {
       printf("Start server error\n");
       exit(1);
    }
 
-   Lock *mutex = (Lock*)malloc(sizeof(Lock));
-   pthread_mutex_init(&(mutex->lock), NULL);
-   PlayerRecord *scoreboard = (PlayerRecord*)malloc(sizeof(PlayerRecord)*10);
-   fd = open("scoreboard.bin", O_CREAT|O_RDWR, S_IRUSR|S_IWUSR);
-   loadScoreboard(fd, scoreboard);   
-   startSave(fd, scoreboard, mutex);
+   Registry *scoreboard = createRegistry();
+   Storage *storage = openStorage(scoreboard, syncMs);
+   // Scoreboard files could not be opened
+   if(storage == NULL) {
+      printf("Scoreboard file error\n");
+      exit(1);
+   }
+
+   Server *server = (Server*)malloc(sizeof(Server));
+   server->reactor = createReactor();
+   server->scoreboard = scoreboard;
+   server->storage = storage;
+   server->leaders = createLeaderboard(scoreboard, playerRating);
+   server->seats = createSeats();
+   server->journal = openJournal(JOURNAL_DIR);
+   // Journal could not be started
+   if(server->journal == NULL) {
+      printf("Journal file error\n");
+      exit(1);
+   }
+   server->audiences = createAudiences();
+   server->watchPolicy = watchPolicy;
+   // Rank every player loaded from disk
+   for(loc = 0; loc < countPlayers(scoreboard); loc++) {
+      rankPlayer(server->leaders, loc);
+   }
+   server->lobby = createLobby(policy, dispatchMatches, server);
+   server->pool = createPool(workers, pin, startSession);
+   server->boardSize = size;
+   server->boardRun = run;
+   server->search = createSearchPool(SEARCH_THREADS);
+   server->searchDepth = depth;
+   server->searchBudget = budget;
+   // Computer has a record like any player, if there is room for one
+   server->computerLoc = acceptName(server, COMPUTER, COMPUTER);
+   if(server->computerLoc < 0) {
+      printf("No room on scoreboard for the computer\n");
+      soloAfter = 0;
+   }
+   server->lobby->soloAfter = soloAfter;
+   server->lastReport = time(NULL);
+   server->lastSubmitted = 0;
+   // Event loop or worker pool could not be created
+   if(server->reactor == NULL || server->pool == NULL) {
+      printf("Event loop error\n");
+      exit(1);
+   }
+   Connection *listener = addConnection(server->reactor, sockfd,
+                                        acceptPlayers, server);
+   watchInput(listener, 1);
+   setBatchHook(server->reactor, runLobby, server, MATCH_TICK);
 
    // Continue accepting players and hosting games until Ctrl + C
+   runReactor(server->reactor);
+}
+
+/* Event handler called when players are waiting to connect.
+   Accepts all of them and starts their logins without
+   waiting for any of them to send their login.
+*/
+void acceptPlayers(Connection *listener, int events) {
+   Server *server = (Server*) listener->owner;
+   LoginContext *login;
+   Connection *conn;
+   int playersockfd;
+
+   // Accept until no more players are waiting
+   while((playersockfd = accept(listener->fd, NULL, NULL)) != -1) {
+      login = (LoginContext*)malloc(sizeof(LoginContext));
+      login->server = server;
+      login->state = AWAIT_LOGIN_HEADER;
+      conn = addConnection(server->reactor, playersockfd, loginPlayer, login);
+      // Player could not be watched
+      if(conn == NULL) {
+         close(playersockfd);
+         free(login);
+         continue;
+      }
+      printf("Player connected\n");
+      watchInput(conn, 1);
+   }
+}
+
+/* Event handler called when a player who is logging in has
+   sent data. Once the whole login frame has arrived the
+   player is logged in or registered and then paired.
+*/
+void loginPlayer(Connection *conn, int events) {
+   LoginContext *login = (LoginContext*) conn->owner;
+   Server *server = login->server;
+   Message reply;
+   Seat *seat;
+   int got, loc;
+
+   // Answer rankings frames until the login or resume frame
    while(1) {
-      GameContext *game = (GameContext*)malloc(sizeof(GameContext));
-      game->scoreboard = scoreboard;
-      game->mutex = mutex;
-      acceptPlayer1(game, sockfd);
-      acceptPlayer2(game, sockfd);
-      start_subserver(game);
-   }
-}
-
-/* Function prepares  save struct to be passed to
-   saveThread and create that said thread.
-*/ 
-void startSave(int fd, PlayerRecord *scoreboard, Lock *mutex) {
-   pthread_t saveT;
-   Save *save = (Save*)malloc(sizeof(save));
-   save->scoreboard = scoreboard;
-   save->fd = fd;
-   save->mutex = mutex;
-   pthread_create(&saveT, NULL, saveThread, (void *) save);
-}
-
-/* Thread function which saves scoreboard data every
-   five minutes.
-*/
-void *saveThread(void *args) {
-   Save *save = (Save*) args;
-   PlayerRecord *record;
-   int i;
-   int curTime = time(NULL);
-   int saveTime = curTime + 300;
-   
-   // Continously save while server is running
-   while(1) {
-      curTime = time(NULL);
-      // If five minutes has passed
-      if(curTime >= saveTime) {
-         pthread_mutex_lock(&(save->mutex->lock));
-         printf("Saving\n");
-         i = 0;
-         // While end of scoreboard or registered players has not been reached
-         while(i != 10 && strcmp(save->scoreboard[i].name,"") != 0) {
-            record = &save->scoreboard[i];
-            writeRecordAt(save->fd, record, i);
-            i++;
-         }
-         pthread_mutex_unlock(&(save->mutex->lock));
-         curTime = time(NULL);
-         saveTime = curTime + 300;
+      got = recvLogin(login, conn);
+      // Rest of the login frame has not arrived yet
+      if(got == 0) { return; }
+      // Player left or sent a malformed frame
+      if(got < 0) {
+         free(login);
+         closeConnection(conn);
+         return;
       }
-      // Five minutes has not passed since last save
-      else {
-         sleep(1);
+      if(login->type == LOGIN) { break; }
+      // Player is taking their seat in a game again
+      if(login->type == RESUME) {
+         resumeSeat(server, conn, login);
+         free(login);
+         return;
+      }
+      // Spectator is watching a game instead of playing
+      if(login->type == WATCH) {
+         watchGame(server, conn, login);
+         free(login);
+         return;
       }
-   } 
+      sendRanks(server, conn, login);
+      login->state = AWAIT_LOGIN_HEADER;
+   }
+   // Nobody may log in as the computer
+   if(strcmp(login->body, COMPUTER) == 0) { loc = -2; }
+   else {
+      loc = acceptName(server, login->body, login->body + login->nameSize);
+   }
+   initMessage(&reply);
+   putInt(&reply, loc >= 0 ? 0 : loc);  // 0 tells player they were accepted
+   // Player was not logged in or registered
+   if(loc < 0) {
+      sendMessageTo(conn, &reply);
+      free(login);
+      closeConnection(conn);
+      return;
+   }
+   // Token to resume with follows, high half first
+   seat = openSeat(server->seats, loc);
+   putInt(&reply, (int) (seat->token >> 32));
+   putInt(&reply, (int) seat->token);
+   sendMessageTo(conn, &reply);
+   enterLobby(server, conn, loc, seat, login);
+   free(login);
 }
 
-/* Function writes record at given index
+/* Function receives the login frame: a frame type, the
+   name, password, and requested opponent sizes, then the
+   name, password, and requested opponent. An opponent of
+   "" requests anyone. A rankings frame may come instead:
+   a frame type, the first rank and number of ranks asked
+   for, and the name size, then a name to be ranked, which
+   may be "". A resume frame may come instead: a frame
+   type, the high and low halves of the token given at
+   login, and the name size, then the player's name. A
+   watch frame may come instead: a frame type, the id of
+   the game to watch, and two zeros, with nothing after.
+   Returns 1 once the whole frame was received, 0 if more
+   input is needed, and -1 on error.
 */
-int writeRecordAt(int fd, PlayerRecord *record, int index) {
-   // Cursor unsuccessfully adjusted
-   if(lseek(fd, index * sizeof(PlayerRecord), SEEK_SET) < 0) {
-      return -1;
+int recvLogin(LoginContext *login, Connection *conn) {
+   char header[LOGIN_HEADER_SIZE];
+   int got;
+
+   // Header tells how large the name and password are
+   if(login->state == AWAIT_LOGIN_HEADER) {
+      got = recvField(conn, header, LOGIN_HEADER_SIZE);
+      if(got <= 0) { return got; }
+      login->type = header[0];
+      // Rankings frame has only a name to receive
+      if(login->type == RANKS) {
+         login->first = getInt(header + sizeof(char));
+         login->count = getInt(header + sizeof(char) + sizeof(int));
+         login->nameSize = getInt(header + sizeof(char) + 2 * sizeof(int));
+         login->passSize = 0;
+         login->oppSize = 0;
+         // Ranks or name cannot be answered
+         if(login->first < 1 || login->count < 0 || login->count > MAX_RANKS
+            || login->nameSize < 1 || login->nameSize > 21) {
+            return -1;
+         }
+         login->state = AWAIT_LOGIN_BODY;
+      }
+      // Resume frame also has only a name to receive
+      else if(login->type == RESUME) {
+         login->token = (unsigned int) getInt(header + sizeof(char));
+         login->token <<= 32;
+         login->token |= (unsigned int) getInt(header + sizeof(char)
+                                               + sizeof(int));
+         login->nameSize = getInt(header + sizeof(char) + 2 * sizeof(int));
+         login->passSize = 0;
+         login->oppSize = 0;
+         // Name cannot fit in a record
+         if(login->nameSize < 2 || login->nameSize > 21) { return -1; }
+         login->state = AWAIT_LOGIN_BODY;
+      }
+      // Watch frame is whole with its header
+      else if(login->type == WATCH) {
+         login->gameId = getInt(header + sizeof(char));
+         return 1;
+      }
+      else {
+         login->nameSize = getInt(header + sizeof(char));
+         login->passSize = getInt(header + sizeof(char) + sizeof(int));
+         login->oppSize = getInt(header + sizeof(char) + 2 * sizeof(int));
+         // Frame is not a login or a field cannot fit in a record
+         if(login->type != LOGIN || login->nameSize < 2 || login->nameSize > 21
+            || login->passSize < 1 || login->passSize > 21
+            || login->oppSize < 1 || login->oppSize > 21) {
+            return -1;
+         }
+         login->state = AWAIT_LOGIN_BODY;
+      }
+   }
+   got = recvField(conn, login->body,
+                   login->nameSize + login->passSize + login->oppSize);
+   if(got <= 0) { return got; }
+   // Name to be ranked or resumed must be a string
+   if(login->type != LOGIN) {
+      return login->body[login->nameSize - 1] == '\0' ? 1 : -1;
    }
-   // Write unsuccessful
-   if(write(fd, record, sizeof(PlayerRecord)) <= 0) {
+   // Name, password, and opponent must all be strings
+   if(login->body[login->nameSize - 1] != '\0'
+      || login->body[login->nameSize + login->passSize - 1] != '\0'
+      || login->body[login->nameSize + login->passSize
+                     + login->oppSize - 1] != '\0') {
       return -1;
    }
-   // Write successful
-   return 0;
+   return 1;
 }
 
-/* Function loades scoreboard from previous
-   server session.
+/* Function answers a rankings frame with the number of
+   players ranked, the rank of the name asked about, 0 if
+   they are not ranked, and the number of players found
+   from the first rank asked for. Each player found follows
+   with their name, wins, losses, ties, and rating.
 */
-void loadScoreboard(int fd, PlayerRecord *scoreboard) {
-   int i = 0;
-   PlayerRecord *record;
+void sendRanks(Server *server, Connection *conn, LoginContext *login) {
+   PlayerRecord record;
+   Message reply;
+   int locs[MAX_RANKS];
+   int loc, found, i;
+
+   pthread_mutex_lock(&server->scoreboard->lock);
+   loc = findPlayer(server->scoreboard, login->body);
+   pthread_mutex_unlock(&server->scoreboard->lock);
+   found = rankedPlayers(server->leaders, login->first, login->count, locs);
 
-   // While records from file continue to exist
-   while((record = readRecordAt(fd, i)) != NULL) {
-      strcpy(scoreboard[i].name, record->name);
-      strcpy(scoreboard[i].password, record->password);
-      scoreboard[i].wins = record->wins;
-      scoreboard[i].losses = record->losses;
-      scoreboard[i].ties = record->ties;
-      i++;
+   initMessage(&reply);
+   putInt(&reply, countRanked(server->leaders));
+   putInt(&reply, loc >= 0 ? playerRank(server->leaders, loc) : 0);
+   putInt(&reply, found);
+   for(i = 0; i < found; i++) {
+      copyPlayer(server->scoreboard, locs[i], &record);
+      putString(&reply, record.name);
+      putInt(&reply, record.wins);
+      putInt(&reply, record.losses);
+      putInt(&reply, record.ties);
+      putInt(&reply, playerRating(&record));
    }
+   sendMessageTo(conn, &reply);
 }
 
-/* Function reads record at given index.
+/* Function hands a player who resumes to the game their
+   seat is in. The seat must be in a game and held by the
+   same name. The game's worker takes the connection from the
+   seat once woken and answers the player with the board, so
+   nothing more is sent from here.
 */
-PlayerRecord *readRecordAt(int fd, int index) {
-   PlayerRecord *record = (PlayerRecord*)malloc(sizeof(PlayerRecord));
+void resumeSeat(Server *server, Connection *conn, LoginContext *login) {
+   Seat *seat;
+   uint64_t one = 1;
 
-   // Cursor unsuccessfully adjusted
-   if(lseek(fd, index * sizeof(PlayerRecord), SEEK_SET) < 0) {
-      return NULL;
+   pthread_mutex_lock(&server->seats->lock);
+   seat = findSeat(server->seats, login->token);
+   // Seat can be resumed unless another connection is already resuming it
+   if(seat != NULL && seat->game != NULL && seat->resumed == NULL
+      && strcmp(getPlayer(server->scoreboard, seat->loc)->name,
+                login->body) == 0) {
+      conn->handler = NULL;
+      detachConnection(conn);
+      seat->resumed = conn;
+      write(seat->wakefd, &one, sizeof(one));
+      pthread_mutex_unlock(&server->seats->lock);
+      printf("Player resuming\n");
+      return;
    }
-   // Read unsuccessful
-   if(read(fd, record, sizeof(PlayerRecord)) <= 0) {
-      return NULL;
-   }
-   // Read successful
-   return record;
+   pthread_mutex_unlock(&server->seats->lock);
+   refuseResume(conn);
 }
 
-/* Function accepts player for player 1 status.
+/* Function tells a player or spectator there is no game to
+   resume or watch and closes their connection.
 */
-void acceptPlayer1(GameContext *game, int sockfd) {
-   int player1sockfd, loc;
- 
-   // Until a player has successfully been registered
-   while(1) {
-      player1sockfd = accept_client(sockfd);
-      loc = acceptName(game->scoreboard, player1sockfd, game->mutex);
-      // If player was succesfully registered, break from loop
-      if(loc >= 0) { break; } 
-   }
-   assignXGameContext(game, loc, player1sockfd);
+void refuseResume(Connection *conn) {
+   Message reply;
+
+   initMessage(&reply);
+   putInt(&reply, NO_GAME);
+   sendMessageTo(conn, &reply);
+   closeConnection(conn);
 }
 
-/* Function accepts player for player 2 status.
+/* Function hands a spectator to the game they asked to
+   watch. The game's worker takes the connection once woken
+   and tells the spectator what they are watching, so nothing
+   more is sent from here.
 */
-void acceptPlayer2(GameContext *game, int sockfd) {
-   int player2sockfd, loc;
-   
-   // Until a player has successfully been registered
-   while(1) {
-      player2sockfd = accept_client(sockfd);
-      loc = acceptName(game->scoreboard, player2sockfd, game->mutex);
-      // If player was successfully registered, break from loop
-      if(loc >= 0) { break; }
+void watchGame(Server *server, Connection *conn, LoginContext *login) {
+   Audience *audience;
+
+   pthread_mutex_lock(&server->audiences->lock);
+   audience = findAudience(server->audiences, login->gameId);
+   // Game is being played
+   if(audience != NULL) {
+      conn->handler = NULL;
+      detachConnection(conn);
+      arriveSpectator(audience, conn);
+      pthread_mutex_unlock(&server->audiences->lock);
+      printf("Spectator joining game %d\n", login->gameId);
+      return;
    }
-   assignOGameContext(game, loc, player2sockfd);
+   pthread_mutex_unlock(&server->audiences->lock);
+   refuseResume(conn);
 }
 
 /* Function adds player X to game context.
 */
-void assignXGameContext(GameContext *game, int loc, int playersockfd) {
+void assignXGameContext(GameContext *game, int loc, Connection *conn) {
    game->playerXId = loc;   // Location of player X in scoreboard
-   game->playerXSockfd = playersockfd;
+   game->playerXSockfd = conn->fd;
+   game->playerX = conn;
 }
 
 /* Function adds player O to game context.
 */
-void assignOGameContext(GameContext *game, int loc, int playersockfd) {
+void assignOGameContext(GameContext *game, int loc, Connection *conn) {
    game->playerOId = loc;   // Location of player X in scoreboard
-   game->playerOSockfd = playersockfd;
+   game->playerOSockfd = conn->fd;
+   game->playerO = conn;
 }
 
-/* Function creates thread and passes it the
-   game context.
+/* Function places a logged in player in the matchmaking
+   lobby. While waiting the player is only watched for
+   leaving, so a player who never gets paired holds up no one.
+   A player who asked for the computer plays it right away.
 */
-void start_subserver(GameContext *game) {
-   pthread_t tsubserver;
-   pthread_create(&tsubserver, NULL, subserver, (void *) game);
+void enterLobby(Server *server, Connection *conn, int loc, Seat *seat,
+                LoginContext *login) {
+   LobbyEntry entry;
+   PlayerRecord record;
+   Match match;
+
+   entry.player = conn;
+   entry.loc = loc;
+   entry.seat = seat;
+   strcpy(entry.name, login->body);
+   strcpy(entry.opponent, login->body + login->nameSize + login->passSize);
+   copyPlayer(server->scoreboard, loc, &record);
+   entry.rating = playerRating(&record);
+   // Player asked for the computer, no need to wait
+   if(strcmp(entry.opponent, COMPUTER) == 0 && server->computerLoc >= 0) {
+      match.x = entry;
+      memset(&match.o, 0, sizeof(LobbyEntry));
+      dispatchMatches(server, &match, 1);
+      return;
+   }
+   joinLobby(server->lobby, &entry);
+
+   conn->handler = waitInLobby;
+   conn->owner = server;
+}
+
+/* Event handler called when a player waiting in the lobby
+   sends data or leaves. Players who left are removed from
+   the lobby. Early input is left for the game to receive.
+*/
+void waitInLobby(Connection *conn, int events) {
+   Server *server = (Server*) conn->owner;
+   Seat *seat;
+   char peek;
+   int got = recv(conn->fd, &peek, sizeof(char), MSG_PEEK);
+
+   // Player left the lobby, their seat is in no game to resume
+   if(got == 0 || (got < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+      printf("Player left the lobby\n");
+      seat = (Seat*) leaveLobby(server->lobby, conn);
+      if(seat != NULL) { closeSeat(server->seats, seat); }
+      closeConnection(conn);
+   }
+   // Player sent data early, stop watching until game starts
+   else if(got > 0) {
+      watchInput(conn, 0);
+   }
 }
 
-/* Thread function hosts the game for both players
-   and prints the final results.
+/* Batch hook runs a matching pass once the event loop has
+   handled a batch of events, and reports on the worker pool
+   while games are being played.
 */
-void *subserver(void *ptr) {
-   GameContext *game = (GameContext *) ptr;
-   int player1 = 1;
-   int player2 = 2;
-   send(game->playerXSockfd, &player1, sizeof(int), 0);
-   send(game->playerOSockfd, &player2, sizeof(int), 0);
+void runLobby(void *arg) {
+   Server *server = (Server*) arg;
+   time_t now = time(NULL);
+   long submitted;
+
+   runMatching(server->lobby);
+   // Report only if games were started since the last report
+   if(now - server->lastReport >= POOL_REPORT) {
+      submitted = atomic_load(&server->pool->submitted);
+      if(submitted != server->lastSubmitted) {
+         printPoolStats(server->pool);
+         printWireStats();
+      }
+      server->lastSubmitted = submitted;
+      server->lastReport = now;
+   }
+}
+
+/* Function hands every match made in one matching pass to
+   the worker pool as a game session. A match without a
+   player O is played against the computer. Players may
+   resume into their game from the moment it is dispatched.
+*/
+void dispatchMatches(void *arg, Match *matches, int count) {
+   Server *server = (Server*) arg;
+   GameContext *game;
+   int i, wakefd;
+
+   for(i = 0; i < count; i++) {
+      game = (GameContext*)malloc(sizeof(GameContext));
+      game->scoreboard = server->scoreboard;
+      game->storage = server->storage;
+      game->leaders = server->leaders;
+      game->seats = server->seats;
+      game->journal = server->journal;
+      game->audiences = server->audiences;
+      game->grace = NULL;
+      game->search = server->search;
+      game->searchDepth = server->searchDepth;
+      game->searchBudget = server->searchBudget;
+      initBoard(&game->board, server->boardSize, server->boardRun);
+      assignXGameContext(game, matches[i].x.loc,
+                         (Connection*) matches[i].x.player);
+      // If player X plays the computer
+      if(matches[i].o.player == NULL) {
+         game->computer = PLAYER2;
+         game->playerOId = server->computerLoc;
+         game->playerOSockfd = -1;
+         game->playerO = NULL;
+      }
+      else {
+         game->computer = 0;
+         assignOGameContext(game, matches[i].o.loc,
+                            (Connection*) matches[i].o.player);
+      }
+      // Players now belong to whichever worker adopts the game
+      game->playerX->handler = NULL;
+      detachConnection(game->playerX);
+      if(game->playerO != NULL) {
+         game->playerO->handler = NULL;
+         detachConnection(game->playerO);
+      }
+      game->seatX = (Seat*) matches[i].x.seat;
+      game->seatO = (Seat*) matches[i].o.seat;
+      wakefd = eventfd(0, EFD_NONBLOCK);
+      pthread_mutex_lock(&server->seats->lock);
+      game->seatX->game = game;
+      game->seatX->symbol = PLAYER1;
+      game->seatX->wakefd = wakefd;
+      if(game->seatO != NULL) {
+         game->seatO->game = game;
+         game->seatO->symbol = PLAYER2;
+         game->seatO->wakefd = wakefd;
+      }
+      pthread_mutex_unlock(&server->seats->lock);
+      // Spectators may arrive from the moment the game is dispatched
+      game->audience = openAudience(server->audiences, wakefd,
+                                    server->watchPolicy);
+      printf("Game %d started\n", game->audience->id);
+      submitSession(server->pool, game);
+   }
+}
+
+/* Function starts a game session on the worker which
+   adopted it.
+*/
+void startSession(Reactor *reactor, void *session) {
+   GameContext *game = (GameContext*) session;
+
+   game->reactor = reactor;
+   // Players resumed or spectators arrived before the game started
+   // are taken right away
+   game->resumes = addConnection(reactor, game->seatX->wakefd, gameWoken,
+                                 game);
+   watchInput(game->resumes, 1);
+   // Players are only listened to once the game is on their turn
+   game->playerX->handler = playGame;
+   game->playerX->owner = game;
+   game->playerX->reading = 0;
+   attachConnection(reactor, game->playerX);
+   // Computer has no connection
+   if(game->playerO != NULL) {
+      game->playerO->handler = playGame;
+      game->playerO->owner = game;
+      game->playerO->reading = 0;
+      attachConnection(reactor, game->playerO);
+   }
+   startGame(game);
+   // First turn may have been sent along with the login and be
+   // buffered already, in which case epoll will not report it
+   playGame(game->playerX, 0);
+}
+
+/* Function gives the rating players are matched and ranked
+   by, which is their Elo rating.
+*/
+int playerRating(PlayerRecord *record) {
+   return record->rating;
+}
+
+/* Function gives how far a player's rating moves after a
+   game against an opponent, given the half points they
+   scored: 2 for a win, 1 for a draw, and 0 for a loss. The
+   opponent's rating moves the other way by as much.
+*/
+int ratingChange(int rating, int opponent, int halfPoints) {
+   double expected = 1.0 / (1.0 + pow(10.0, (opponent - rating) / 400.0));
+   return (int) lround(RATING_K * (halfPoints / 2.0 - expected));
+}
+
+/* Function tells both players their number, the board
+   size and run to win, and names and starts the game. From
+   then on the game only advances when the mover sends data.
+*/
+void startGame(GameContext *game) {
+   struct timespec now;
+
+   clock_gettime(CLOCK_REALTIME, &now);
+   game->started = now.tv_sec * 1000LL + now.tv_nsec / 1000000;
+   initMessage(&game->toX);
+   initMessage(&game->toO);
+   putInt(&game->toX, 1);
+   putInt(&game->toO, 2);
+   putInt(&game->toX, game->board.size);
+   putInt(&game->toX, game->board.run);
+   putInt(&game->toO, game->board.size);
+   putInt(&game->toO, game->board.run);
    sendNames(game);
-   playGame(game);
+   flushMessages(game);
+
+   game->turn = PLAYER1;
+   game->state = AWAIT_CHAT_OPTION;
+   // Player 1 moves first
+   watchInput(game->playerX, 1);
+}
+
+/* Function ends a finished game by sending the final game
+   context and the result to spectators, printing both
+   players' records, and closing both players.
+*/
+void endGame(GameContext *game, int result) {
    sendGameContext(game);
-   printScoreboard(game);
+   flushMessages(game);
+   updateSpectators(game, result);
+   printResults(game);
+   closeGame(game);
+}
+
+/* Function ends a game a player left and did not resume
+   before it was over. No result is recorded.
+*/
+void abandonGame(GameContext *game) {
+   printf("Player did not resume, game abandoned\n\n");
+   recordGame(game, ABANDONED);
+   updateSpectators(game, ABANDONED);
+   closeGame(game);
+}
+
+/* Function closes both players' seats and connections,
+   the game's audience, eventfd, and timer, and frees the
+   game. A player still waiting to resume or a spectator
+   still waiting to watch is told there is no game.
+*/
+void closeGame(GameContext *game) {
+   Connection *resumed;
+   Spectator *late, *next;
+
+   resumed = (Connection*) closeSeat(game->seats, game->seatX);
+   if(resumed != NULL) {
+      attachConnection(game->reactor, resumed);
+      refuseResume(resumed);
+   }
+   // Computer has no seat
+   if(game->seatO != NULL) {
+      resumed = (Connection*) closeSeat(game->seats, game->seatO);
+      if(resumed != NULL) {
+         attachConnection(game->reactor, resumed);
+         refuseResume(resumed);
+      }
+   }
+   for(late = closeAudience(game->audiences, game->audience); late != NULL;
+       late = next) {
+      next = late->next;
+      attachConnection(game->reactor, late->conn);
+      refuseResume(late->conn);
+      free(late);
+   }
+   closeConnection(game->resumes);
+   if(game->grace != NULL) { closeConnection(game->grace); }
+   if(game->playerX != NULL) { closeConnection(game->playerX); }
+   if(game->playerO != NULL) { closeConnection(game->playerO); }
    free(game);
 }
 
-/* Function prints all the players currently registered on
-   the server and their wins, losses, and ties.
+/* Function takes a player who left out of the game and
+   waits for them to resume. One timer runs while anyone is
+   away, so a player who leaves while the other is already
+   away only has what is left of it.
+*/
+void leaveGame(GameContext *game, char symbol) {
+   struct itimerspec grace;
+   int timerfd;
+
+   printf("Player disconnected, waiting for them to resume\n\n");
+   dropPlayer(game, symbol);
+   // Other player is already being waited for
+   if(game->grace != NULL) { return; }
+   memset(&grace, 0, sizeof(grace));
+   grace.it_value.tv_sec = GRACE_SECONDS;
+   timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+   timerfd_settime(timerfd, 0, &grace, NULL);
+   game->grace = addConnection(game->reactor, timerfd, graceExpired, game);
+   watchInput(game->grace, 1);
+}
+
+/* Function closes a player's connection. A player who was
+   moving starts their turn over, unless their chat already
+   reached the other player, who then only waits for the move.
+*/
+void dropPlayer(GameContext *game, char symbol) {
+   Connection **conn = symbol == PLAYER1 ? &game->playerX : &game->playerO;
+   Message *toOther = symbol == PLAYER1 ? &game->toO : &game->toX;
+
+   closeConnection(*conn);
+   *conn = NULL;
+   // Part of the turn not yet passed on is thrown away
+   if(game->turn == symbol && toOther->len > 0) {
+      initMessage(toOther);
+      game->state = AWAIT_CHAT_OPTION;
+   }
+}
+
+/* Event handler called when nobody away resumed in time.
+*/
+void graceExpired(Connection *conn, int events) {
+   GameContext *game = (GameContext*) conn->owner;
+   uint64_t count;
+
+   read(conn->fd, &count, sizeof(count));
+   abandonGame(game);
+}
+
+/* Event handler called when a player resumed into the game
+   or a spectator arrived to watch it. Every connection
+   waiting in a seat is taken under the seats' lock and then
+   rejoined, and every spectator waiting is admitted.
+*/
+void gameWoken(Connection *conn, int events) {
+   GameContext *game = (GameContext*) conn->owner;
+   Connection *resumedX, *resumedO = NULL;
+   Spectator *arrived, *next;
+   uint64_t count;
+
+   read(conn->fd, &count, sizeof(count));
+   pthread_mutex_lock(&game->seats->lock);
+   resumedX = (Connection*) game->seatX->resumed;
+   game->seatX->resumed = NULL;
+   if(game->seatO != NULL) {
+      resumedO = (Connection*) game->seatO->resumed;
+      game->seatO->resumed = NULL;
+   }
+   pthread_mutex_unlock(&game->seats->lock);
+   if(resumedX != NULL) { rejoinGame(game, PLAYER1, resumedX); }
+   if(resumedO != NULL) { rejoinGame(game, PLAYER2, resumedO); }
+   for(arrived = takeArrivals(game->audiences, game->audience);
+       arrived != NULL; arrived = next) {
+      next = arrived->next;
+      admitSpectator(game, arrived);
+   }
+}
+
+/* Function lets a spectator watch the game from now on. The
+   spectator is sent 0, the game's id, the board size and
+   run to win, the names of players X and O, and then the
+   game as it stands, as every later update is sent.
+*/
+void admitSpectator(GameContext *game, Spectator *spectator) {
+   Message first;
+
+   attachConnection(game->reactor, spectator->conn);
+   initMessage(&first);
+   putInt(&first, 0);  // 0 tells spectator they are watching
+   putInt(&first, game->audience->id);
+   putInt(&first, game->board.size);
+   putInt(&first, game->board.run);
+   putString(&first, getPlayer(game->scoreboard, game->playerXId)->name);
+   putString(&first, getPlayer(game->scoreboard, game->playerOId)->name);
+   putSpectatorUpdate(&first, game, PLAYING);
+   addSpectator(game->audience, spectator, &first);
+   printf("Spectator watching game %d\n", game->audience->id);
+}
+
+/* Function sends every spectator the game after a move or
+   once it is over. The update is built once for all of them.
+*/
+void updateSpectators(GameContext *game, int result) {
+   Message update;
+
+   // Nobody is watching
+   if(game->audience->watching == NULL) { return; }
+   initMessage(&update);
+   putSpectatorUpdate(&update, game, result);
+   publishUpdate(game->audience, &update);
+}
+
+/* Function adds the moves made so far, the result, which is
+   PLAYING until the game is over and then a journal result,
+   and the board to a spectator's message.
+*/
+void putSpectatorUpdate(Message *msg, GameContext *game, int result) {
+   putInt(msg, game->board.moves);
+   putInt(msg, result);
+   putBoard(msg, &game->board);
+}
+
+/* Function puts a resumed player back in the game in place
+   of their old connection, which may not have been seen to
+   drop yet. The player is sent one message: 0, their number,
+   the board size and run to win, whose turn it is, and the
+   board. The timer stops once no one is away.
+*/
+void rejoinGame(GameContext *game, char symbol, Connection *conn) {
+   Connection *old = symbol == PLAYER1 ? game->playerX : game->playerO;
+   Message reply;
+
+   // Old connection is still in the game
+   if(old != NULL) { dropPlayer(game, symbol); }
+   conn->handler = playGame;
+   conn->owner = game;
+   conn->reading = 0;
+   attachConnection(game->reactor, conn);
+   if(symbol == PLAYER1) { assignXGameContext(game, game->playerXId, conn); }
+   else { assignOGameContext(game, game->playerOId, conn); }
+   printf("Player resumed\n\n");
+
+   initMessage(&reply);
+   putInt(&reply, 0);  // 0 tells player they resumed
+   putInt(&reply, symbol == PLAYER1 ? 1 : 2);
+   putInt(&reply, game->board.size);
+   putInt(&reply, game->board.run);
+   putInt(&reply, resumeTurn(game, symbol));
+   putBoard(&reply, &game->board);
+   sendMessageTo(conn, &reply);
+   // Nobody else is away
+   if(game->grace != NULL && game->playerX != NULL
+      && (game->playerO != NULL || game->computer == PLAYER2)) {
+      closeConnection(game->grace);
+      game->grace = NULL;
+   }
+   watchMover(game, 1);
+}
+
+/* Function tells a resumed player whose turn it is. A turn
+   whose chat already went out, to the player's old
+   connection or from it, has only the move left.
 */
-void printScoreboard(GameContext *game) {
-   pthread_mutex_lock(&(game->mutex->lock));
-   printf("Scoreboard:\n");
-   int i = 0;
-   // While players still exist on scoreboard and end of
-   // scoreboard has not been reached
-   while(strcmp(game->scoreboard[i].name, "") != 0 && i != 10) {
-      printf("Name: %s\n", game->scoreboard[i].name);
-      printf("Wins: %d\n", game->scoreboard[i].wins);
-      printf("Losses: %d\n", game->scoreboard[i].losses);
-      printf("Ties: %d\n\n", game->scoreboard[i].ties);
-      i++;
-   } 
-   pthread_mutex_unlock(&(game->mutex->lock));
+int resumeTurn(GameContext *game, char symbol) {
+   Message *toPlayer = symbol == PLAYER1 ? &game->toX : &game->toO;
+   Message *toOther = symbol == PLAYER1 ? &game->toO : &game->toX;
+
+   if(game->turn == symbol) {
+      return game->state == AWAIT_MOVE && toOther->len == 0 ? YOUR_MOVE
+                                                            : YOUR_TURN;
+   }
+   return game->state == AWAIT_MOVE && toPlayer->len == 0 ? THEIR_MOVE
+                                                          : THEIR_TURN;
 }
 
-/* Function sends game context to players.
+/* Function prints the records of the two players of a
+   finished game. The whole scoreboard is never printed
+   here, since it runs on the game's worker and would hold
+   up every other game on it.
+*/
+void printResults(GameContext *game) {
+   PlayerRecord x, o;
+
+   copyPlayer(game->scoreboard, game->playerXId, &x);
+   copyPlayer(game->scoreboard, game->playerOId, &o);
+   printf("Game %d over: %s %d-%d-%d (%d), %s %d-%d-%d (%d)\n\n",
+          game->audience->id, x.name, x.wins, x.losses, x.ties, x.rating,
+          o.name, o.wins, o.losses, o.ties, o.rating);
+}
+
+/* Function adds game context to the players' output, from
+   copies of both players' records.
 */
 void sendGameContext(GameContext *game) {
+   PlayerRecord x, o;
+
    sendNames(game);
-   pthread_mutex_lock(&(game->mutex->lock));
-   sendToPlayer1(game);
-   sendToPlayer2(game);
-   pthread_mutex_unlock(&(game->mutex->lock));
-}
-
-/* Function sends game stats of player 1 and player 2
-   to player 1.
-*/
-void sendToPlayer1(GameContext *game) {
-   send(game->playerXSockfd, &game->scoreboard[game->playerXId].wins,
-        sizeof(int), 0);
-   send(game->playerXSockfd, &game->scoreboard[game->playerXId].losses,
-        sizeof(int), 0);
-   send(game->playerXSockfd, &game->scoreboard[game->playerXId].ties,
-        sizeof(int), 0);
-   send(game->playerXSockfd, &game->scoreboard[game->playerOId].wins,
-        sizeof(int), 0);
-   send(game->playerXSockfd, &game->scoreboard[game->playerOId].losses,
-        sizeof(int), 0);
-   send(game->playerXSockfd, &game->scoreboard[game->playerOId].ties,
-        sizeof(int), 0);  
-}
-
-/* Function sends game stats of player 2 and player 1
-   to player 2.
-*/
-void sendToPlayer2(GameContext *game) {
-   send(game->playerOSockfd, &game->scoreboard[game->playerOId].wins,
-        sizeof(int), 0);
-   send(game->playerOSockfd, &game->scoreboard[game->playerOId].losses,
-        sizeof(int), 0);
-   send(game->playerOSockfd, &game->scoreboard[game->playerOId].ties,
-        sizeof(int), 0);
-   send(game->playerOSockfd, &game->scoreboard[game->playerXId].wins,
-        sizeof(int), 0);
-   send(game->playerOSockfd, &game->scoreboard[game->playerXId].losses,
-        sizeof(int), 0);
-   send(game->playerOSockfd, &game->scoreboard[game->playerXId].ties,
-        sizeof(int), 0);
-}
-
-/* Function sends names of player 1 and player 2
-   to both player 1 and player 2.
+   copyPlayer(game->scoreboard, game->playerXId, &x);
+   copyPlayer(game->scoreboard, game->playerOId, &o);
+   sendToPlayer1(game, &x, &o);
+   sendToPlayer2(game, &x, &o);
+}
+
+/* Function adds game stats and ratings of player 1 and
+   player 2 to player 1's output.
+*/
+void sendToPlayer1(GameContext *game, PlayerRecord *x, PlayerRecord *o) {
+   putInt(&game->toX, x->wins);
+   putInt(&game->toX, x->losses);
+   putInt(&game->toX, x->ties);
+   putInt(&game->toX, x->rating);
+   putInt(&game->toX, o->wins);
+   putInt(&game->toX, o->losses);
+   putInt(&game->toX, o->ties);
+   putInt(&game->toX, o->rating);
+}
+
+/* Function adds game stats and ratings of player 2 and
+   player 1 to player 2's output.
+*/
+void sendToPlayer2(GameContext *game, PlayerRecord *x, PlayerRecord *o) {
+   putInt(&game->toO, o->wins);
+   putInt(&game->toO, o->losses);
+   putInt(&game->toO, o->ties);
+   putInt(&game->toO, o->rating);
+   putInt(&game->toO, x->wins);
+   putInt(&game->toO, x->losses);
+   putInt(&game->toO, x->ties);
+   putInt(&game->toO, x->rating);
+}
+
+/* Function adds names of player 1 and player 2
+   to the output of both player 1 and player 2.
 */
 void sendNames(GameContext *game) {
-   int p1size = strlen(game->scoreboard[game->playerXId].name)+1;
-   int p2size = strlen(game->scoreboard[game->playerOId].name)+1;
-   
    // player 1 and player 2 receive their own name
-   send(game->playerXSockfd, &p1size, sizeof(int), 0);
-   send(game->playerOSockfd, &p2size, sizeof(int), 0);
-   send(game->playerXSockfd, game->scoreboard[game->playerXId].name,
-        p1size, 0);
-   send(game->playerOSockfd, game->scoreboard[game->playerOId].name,
-        p2size, 0);
+   putString(&game->toX, getPlayer(game->scoreboard, game->playerXId)->name);
+   putString(&game->toO, getPlayer(game->scoreboard, game->playerOId)->name);
    
    // player 1 and player 2 receive each others name
-   send(game->playerXSockfd, &p2size, sizeof(int), 0);
-   send(game->playerOSockfd, &p1size, sizeof(int), 0);
-   send(game->playerOSockfd, game->scoreboard[game->playerXId].name,
-        p1size, 0);
-   send(game->playerXSockfd, game->scoreboard[game->playerOId].name,
-        p2size, 0);
-}
-
-/* Function accepts names from players
-   and registers them in the scoreboard if it is not full.
-   Also returns the location of player on scoreboard.
-*/
-int acceptName(PlayerRecord *scoreboard, int playersockfd, Lock *mutex) {
-   char name[21];
-   int size, loc, comp, result;
-   recv(playersockfd, &size, sizeof(int), 0);
-   recv(playersockfd, name, size, 0);
-   
-   // Loop checks to see if player name is already registered
-   for(loc = 0; loc < 10; loc++) {
-      pthread_mutex_lock(&(mutex->lock));
-      comp = strcmp(name, scoreboard[loc].name);
-      // If name is already on scoreboard
-      if(comp == 0) {
-         // If password was incorrect
-         if(authenticatePlayer(scoreboard,playersockfd,loc) == -2) { return -2; }
-         printf("Player already on scoreboard\n\n");
-         result = 0;
-         send(playersockfd, &result, sizeof(int), 0);
-         pthread_mutex_unlock(&(mutex->lock));
-         return loc;
-      }
-      pthread_mutex_unlock(&(mutex->lock));
-   }
-   // Loop checks to see if empty location in scoreboard exists
-   for(loc = 0; loc < 10; loc++) {
-      pthread_mutex_lock(&(mutex->lock));
-      // If empty space in scoreboard, place player there
-      if(strcmp(scoreboard[loc].name, "") == 0) {
-         strcpy(scoreboard[loc].name, name); 
-         setPassword(scoreboard,playersockfd,loc);
-         printf("Player placed on board\n\n");
-         result = 0;
-         send(playersockfd, &result, sizeof(int), 0);
-         pthread_mutex_unlock(&(mutex->lock)); 
-         return loc;
-      }
-      pthread_mutex_unlock(&(mutex->lock));
+   putString(&game->toO, getPlayer(game->scoreboard, game->playerXId)->name);
+   putString(&game->toX, getPlayer(game->scoreboard, game->playerOId)->name);
+}
+
+/* Function sends a message to a connection in one piece
+   and empties it.
+*/
+void sendMessageTo(Connection *conn, Message *msg) {
+   // Nothing was added to the message
+   if(msg->len == 0) { return; }
+   // Output for the computer is dropped
+   if(conn == NULL) {
+      initMessage(msg);
+      return;
    }
-   return(serverFull(playersockfd));
+   sendConn(conn, msg->data, msg->len);
+   countMessage(msg);
+   initMessage(msg);
+}
+
+/* Function sends the output gathered for both players,
+   one message each.
+*/
+void flushMessages(GameContext *game) {
+   sendMessageTo(game->playerX, &game->toX);
+   sendMessageTo(game->playerO, &game->toO);
+}
+
+/* Function logs in or registers a player by name and
+   password and registers them in the scoreboard if it is
+   not full. A new player is logged before anyone else can
+   be placed, then ranked. Returns the location of player on
+   scoreboard, -2 if the password was incorrect, or -1 if full.
+*/
+int acceptName(Server *server, char *name, char *password) {
+   Registry *scoreboard = server->scoreboard;
+   PlayerRecord record;
+   int loc, result;
+
+   pthread_mutex_lock(&scoreboard->lock);
+   loc = findPlayer(scoreboard, name);
+   // If name is already on scoreboard
+   if(loc >= 0) {
+      result = authenticatePlayer(scoreboard, password, loc);
+      pthread_mutex_unlock(&scoreboard->lock);
+      // If password was incorrect
+      if(result == -2) { return -2; }
+      printf("Player already on scoreboard\n\n");
+      return loc;
+   }
+   // New player starts with no games played
+   memset(&record, 0, sizeof(PlayerRecord));
+   strcpy(record.name, name);
+   record.rating = START_RATING;
+   loc = addPlayer(scoreboard, &record);
+   // If there was room, set the new player's password
+   if(loc >= 0) {
+      setPassword(scoreboard, password, loc);
+      logPlayer(server->storage, loc);
+   }
+   pthread_mutex_unlock(&scoreboard->lock);
+   if(loc < 0) { return(serverFull()); }
+   rankPlayer(server->leaders, loc);
+   printf("Player placed on board\n\n");
+   return loc;
 }
 
 /* Function authenticates prior player by determining whether
    the password they entered is correct.
 */
-int authenticatePlayer(PlayerRecord *scoreboard, int playersockfd, int loc) {
-   int size, result;
-   int incorrect = -2; // Sent to player if password incorrect
-   char password[21];
-   
-   recv(playersockfd, &size, sizeof(int), 0);
-   recv(playersockfd, password, size, 0);
-   
+int authenticatePlayer(Registry *scoreboard, char *password, int loc) {
    // Password incorrect
-   if(strcmp(scoreboard[loc].password, password) != 0) {
+   if(strcmp(getPlayer(scoreboard, loc)->password, password) != 0) {
       printf("Incorrect password received\n");
-      send(playersockfd, &incorrect, sizeof(int), 0);
       return -2;
    }
    // Password correct
@@ -456,291 +1226,300 @@ int authenticatePlayer(PlayerRecord *scoreboard, int playersockfd, int loc) {
 
 /* Function sets the password for a new player.
 */
-void setPassword(PlayerRecord *scoreboard, int playersockfd, int loc) {
-   int size;
-   char password[21];
-   
-   recv(playersockfd, &size, sizeof(int), 0);
-   recv(playersockfd, password, size, 0);
-   strcpy(scoreboard[loc].password, password);
+void setPassword(Registry *scoreboard, char *password, int loc) {
+   strcpy(getPlayer(scoreboard, loc)->password, password);
    printf("Password received and set\n");
 }
 
-/* Function alerts server and player that server is full
-   and cannot accept anymore players.
+/* Function alerts server that server is full and
+   cannot accept anymore players.
 */
-int serverFull(int playersockfd) {
-   int result = -1;
+int serverFull(void) {
    printf("Server full\n");
-   send(playersockfd, &result, sizeof(int), 0);
    return -1;
 }
 
-/* Function creates the board, handles the moves of players 
-   in the correct sequence, sends updated board to players, 
-   and determines if game is over in a win, loss, or draw.
+/* Event handler called whenever the player whose turn it
+   is has sent data or left. Advances the game as far as the
+   data received so far allows.
 */
-void playGame(GameContext *game) {
-   char *board = createBoard(3,3);
-   int gameStat = -1;  // Game not over while -1  
-   char chatOption = 'M'; 
-   // Game ends once a win, loss, or draw occurs which means
-   while(1) {
-       checkForChat(game->playerXSockfd, game->playerOSockfd);
-       makeMove(game->playerXSockfd, PLAYER1, board);
-       gameStat = checkWin(board, PLAYER1);     
-       // If player 1 has won the game
-       if(gameStat == 1) {
-          player1Wins(game, board, gameStat);
-          free(board);
-          break;
-       }
-       gameStat = checkDraw(board);      
-       // If game has ended in a draw
-       if(gameStat == 2) {      
-          draw(game, board, gameStat);
-          free(board);
-          break;
-       }
-       // No win or draw yet, update both players
-       sendUpdate(game->playerXSockfd, game->playerOSockfd, gameStat, board);
-       checkForChat(game->playerOSockfd, game->playerXSockfd); 
-       makeMove(game->playerOSockfd, PLAYER2, board);
-       gameStat = checkWin(board, PLAYER2);
-       // If player 2 has won the game
-       if(gameStat == 1) {
-          player2Wins(game, board, gameStat);
-          free(board);
-          break;
-       }
-       // No win or draw yet, update both players
-       sendUpdate(game->playerXSockfd, game->playerOSockfd, gameStat, board);
-   }
-}
-
-void checkForChat(int sender, int receiver) {
-   char chatOption = 'M';
-
-   recv(sender, &chatOption, sizeof(char), 0);
-   send(receiver, &chatOption, sizeof(char), 0);
-
-   if(chatOption == CHAT) { recvAndSendChat(sender, receiver); }
-} 
-
-void player1Wins(GameContext *game, char *board, int gameStat) {
-   updateGameContext(game, 1);
-   sendResult(game->playerXSockfd, game->playerOSockfd, gameStat, board);
-}
+void playGame(Connection *conn, int events) {
+   GameContext *game = (GameContext*) conn->owner;
+   int status;
 
-void player2Wins(GameContext *game, char *board, int gameStat) {
-   updateGameContext(game, 2);
-   sendResult(game->playerOSockfd, game->playerXSockfd, gameStat, board);
+   // Keep advancing until more input is needed or game is over
+   while((status = advanceTurn(game)) == 1) {}
+   // Player left or broke the protocol
+   if(status == -1) { leaveGame(game, game->turn); }
 }
 
-void draw(GameContext *game, char *board, int gameStat) {
-   updateGameContext(game, 3);
-   sendResult(game->playerXSockfd, game->playerOSockfd, gameStat, board);
+/* Function advances the current turn by one step. Returns 1
+   if the turn advanced, 0 if more input is needed, 2 once
+   the game is over, and -1 if the mover is gone.
+*/
+int advanceTurn(GameContext *game) {
+   Connection *mover = game->turn == PLAYER1 ? game->playerX : game->playerO;
+   Connection *other = game->turn == PLAYER1 ? game->playerO : game->playerX;
+   Message *toOther = game->turn == PLAYER1 ? &game->toO : &game->toX;
+   char size[sizeof(int)];
+   int got;
+
+   switch(game->state) {
+   // Mover chooses to chat first or to make a move
+   case AWAIT_CHAT_OPTION:
+      got = recvField(mover, &game->chatOption, sizeof(char));
+      if(got <= 0) { return got; }
+      // Option reaches the other player together with what follows it
+      putChar(toOther, game->chatOption);
+      game->state = game->chatOption == CHAT ? AWAIT_CHAT_SIZE : AWAIT_MOVE;
+      return 1;
+   case AWAIT_CHAT_SIZE:
+      got = recvField(mover, size, sizeof(int));
+      if(got <= 0) { return got; }
+      game->chatSize = getInt(size);
+      // Message could not fit in the chat buffer
+      if(game->chatSize < 0 || game->chatSize > MAX_CHAT) { return -1; }
+      printf("Receiving player chat\n");
+      game->state = AWAIT_CHAT_MESSAGE;
+      return 1;
+   case AWAIT_CHAT_MESSAGE:
+      // Empty messages have no body to receive
+      if(game->chatSize > 0) {
+         got = recvField(mover, game->chat, game->chatSize);
+         if(got <= 0) { return got; }
+      }
+      printf("Sending player chat\n\n");
+      putInt(toOther, game->chatSize);
+      putBytes(toOther, game->chat, game->chatSize);
+      sendMessageTo(other, toOther);
+      game->state = AWAIT_MOVE;
+      return 1;
+   case AWAIT_MOVE:
+      return makeMove(game, mover);
+   }
+   return -1;
 }
 
-void recvAndSendChat(int sender, int receiver) {
-   printf("Receiving player chat\n");
-   int messageSize = 0;
-   char *message = (char *)malloc(sizeof(char) * 200);
-   recv(sender, &messageSize, sizeof(int), 0);
-   recv(sender, message, messageSize, 0);
+/* Function marks the mover's specified location on the
+   board as long as it is on the board and has not already
+   been taken.
+*/
+int makeMove(GameContext *game, Connection *mover) {
+   Message *toMover = game->turn == PLAYER1 ? &game->toX : &game->toO;
+   char coords[2 * sizeof(int)];
+   int move[2];  // x and y coordinates
+   int taken, got;
 
-   printf("Sending player chat\n\n");
-   send(receiver, &messageSize, sizeof(int), 0);
-   send(receiver, message, messageSize, 0);
+   got = recvField(mover, coords, sizeof(coords));
+   if(got <= 0) { return got; }
+   move[0] = getInt(coords);
+   move[1] = getInt(coords + sizeof(int));
+   // Coordinates off the board are treated as taken
+   if(!onBoard(&game->board, move[0], move[1])) {
+      taken = 0;
+   }
+   else {
+      taken = isTaken(&game->board, move[0], move[1]);
+   }
+   putInt(toMover, taken);
+   // Location is taken, wait for new coordinates
+   if(taken == 0) {
+      sendMessageTo(mover, toMover);
+      return 1;
+   }
 
-   free(message);
-   
+   markBoard(&game->board, move[0], move[1], game->turn);
+   return finishMove(game);
 }
 
-/* Function updates the game context for a given player
-   based on a win, loss. or tie.
+/* Function determines if the last move won or drew the game
+   and otherwise updates both players and passes the turn.
 */
-void updateGameContext(GameContext *game, int status) {
-   pthread_mutex_lock(&(game->mutex->lock));
-   // If player 1 or X has won
-   if(status == 1) {
-      game->scoreboard[game->playerXId].wins++;
-      game->scoreboard[game->playerOId].losses++;
-   }
-   // If player 2 or O has won
-   else if(status == 2) {
-      game->scoreboard[game->playerOId].wins++;
-      game->scoreboard[game->playerXId].losses++;
+int finishMove(GameContext *game) {
+   int gameStat = checkWin(&game->board, game->turn);
+
+   game->cells[game->board.moves - 1] = game->board.last;
+   // If player who moved has won the game
+   if(gameStat == 1) {
+      if(game->turn == PLAYER1) { player1Wins(game, &game->board, gameStat); }
+      else { player2Wins(game, &game->board, gameStat); }
+      endGame(game, game->turn == PLAYER1 ? X_WON : O_WON);
+      return 2;
    }
+   gameStat = checkDraw(&game->board);
    // If game has ended in a draw
-   else if(status == 3) {
-      game->scoreboard[game->playerXId].ties++;
-      game->scoreboard[game->playerOId].ties++;
+   if(gameStat == 2) {
+      draw(game, &game->board, gameStat);
+      endGame(game, DRAWN);
+      return 2;
    }
-   pthread_mutex_unlock(&(game->mutex->lock));
+   // No win or draw yet, update both players, then anyone watching
+   sendUpdate(game, gameStat);
+   flushMessages(game);
+   updateSpectators(game, PLAYING);
+   // Other player only has to be listened to on their turn
+   watchMover(game, 0);
+   game->turn = game->turn == PLAYER1 ? PLAYER2 : PLAYER1;
+   game->state = AWAIT_CHAT_OPTION;
+   // Computer's move is searched for off the event loop
+   if(game->turn == game->computer) {
+      startSearch(game);
+      return 0;
+   }
+   watchMover(game, 1);
+   return 1;
 }
 
-/* Function send indication that game is continuing and also
-   sends the updated board.
+/* Function starts or stops listening to the player whose
+   turn it is, unless that is the computer or a player who
+   is away.
 */
-void sendUpdate(int p1sockfd, int p2sockfd, int gameStat, char *board) {
-   send(p1sockfd, &gameStat, sizeof(int), 0);
-   send(p1sockfd, board, strlen(board)+1, 0);
-   send(p2sockfd, &gameStat, sizeof(int), 0);
-   send(p2sockfd, board, strlen(board)+1, 0);
+void watchMover(GameContext *game, int on) {
+   Connection *mover = game->turn == PLAYER1 ? game->playerX : game->playerO;
+
+   // Computer is not listened to, a player away once they resume
+   if(game->turn == game->computer || mover == NULL) { return; }
+   watchInput(mover, on);
 }
 
-/* Function marks the player's specified location
-   on the board as long as it has not already been
-   taken.
+/* Function hands the position to a search thread. The
+   thread writes an eventfd watched by this game's event loop
+   once the computer's move is chosen.
 */
-void makeMove(int playersockfd, char pSymb, char *board) {
-   int x,y,taken;
-   
-   // Accepts input for coordinates until 
-   // untaken board location is sent
-   while(1) {
-      recv(playersockfd, &x, sizeof(int), 0);
-      recv(playersockfd, &y, sizeof(int), 0);
-      taken = isTaken(board, x, y);
-      
-      // If location on the board is taken
-      if(taken == 0) {
-         send(playersockfd, &taken, sizeof(int), 0);
-      }
-      // Location on the board is not taken, can be marked
-      else { break; }
-   }
-   markBoard(board, x, y, pSymb);
-   send(playersockfd, &taken, sizeof(int), 0);
+void startSearch(GameContext *game) {
+   SearchJob *job = (SearchJob*)malloc(sizeof(SearchJob));
+   Connection *done;
+
+   job->board = game->board;
+   job->symbol = game->computer;
+   job->depth = game->searchDepth;
+   job->budgetMs = game->searchBudget;
+   job->owner = game;
+   job->wakefd = eventfd(0, EFD_NONBLOCK);
+   done = addConnection(game->reactor, job->wakefd,
+                        computerMoved, job);
+   watchInput(done, 1);
+   submitSearch(game->search, job);
 }
 
-/* Function sends results of game to winning player and losing player
-   or sends both players draw result depending on gameStat.
+/* Event handler called once the computer's move was chosen.
+   The move is made as if the computer had sent it, and the
+   player's turn starts with whatever they already sent.
 */
-void sendResult(int winner, int loser, int gameStat, char *board) {
-   int lose = 0; // Sent to player that loses the game
-   
-   // If gameStat is 1, the game has been won by a player
-   if(gameStat == 1) {
-      send(winner, &gameStat, sizeof(int), 0);
-      send(winner, board, strlen(board)+1, 0);
-      send(loser, &lose, sizeof(int), 0); 
-      send(loser, board, strlen(board)+1, 0);
-   }
-   // If gameStat is 2, the game has ended in a draw
-   else if(gameStat == 2) {
-      send(winner, &gameStat, sizeof(int), 0);
-      send(winner, board, strlen(board)+1, 0);
-      send(loser, &gameStat, sizeof(int), 0);
-      send(loser, board, strlen(board)+1, 0);
+void computerMoved(Connection *conn, int events) {
+   SearchJob *job = (SearchJob*) conn->owner;
+   GameContext *game = (GameContext*) job->owner;
+   uint64_t count;
+
+   read(conn->fd, &count, sizeof(count));
+   closeConnection(conn);
+   // Player is told the computer moved without chatting
+   putChar(&game->toX, MOVE);
+   markBoard(&game->board, job->moveX, job->moveY, game->computer);
+   free(job);
+   // Game goes on with the player's turn, unless they are away
+   if(finishMove(game) == 1 && game->playerX != NULL) {
+      playGame(game->playerX, 0);
    }
 }
 
-/* Function gets the symbol at given
-   location on the board.
-*/ 
-char get(char *board, int i, int j) {
-   return board[i*3 + j];
+void player1Wins(GameContext *game, Board *board, int gameStat) {
+   updateGameContext(game, 1);
+   sendResult(&game->toX, &game->toO, gameStat, board);
 }
 
-/* Function determines if location on board is taken.
-   If it is returns a 0, if not returns a 1.
-*/
-int isTaken(char *board, int msgx, int msgy) {
-   char loc = get(board, msgx, msgy);
-   
-   // Location not taken
-   if(loc == EMPTY) {
-      return 1;
-   }
-   // Location is taken
-   else {
-      return 0;
-   } 
-}   
+void player2Wins(GameContext *game, Board *board, int gameStat) {
+   updateGameContext(game, 2);
+   sendResult(&game->toO, &game->toX, gameStat, board);
+}
 
-/* Function marks location on the board with 
-   specified player's symbol.
-*/ 
-void markBoard(char *board, int msgx, int msgy, char playerSymbol) {
-   board[msgx*3 + msgy] = playerSymbol;
+void draw(GameContext *game, Board *board, int gameStat) {
+   updateGameContext(game, 3);
+   sendResult(&game->toX, &game->toO, gameStat, board);
 }
 
-/* Function creates the board used for the 
-   tic-tac-toe game.
+/* Function updates the game context for a given player
+   based on a win, loss. or tie, moves both ratings, logs
+   and ranks both players' new records, and journals the
+   game. Ratings are moved from copies, so no lock is taken.
 */
-char *createBoard(int x, int y) {
-   char *board = (char*)malloc(x*y+1);
-   
-   // Intialize each board location as empty
-   for(int i = 0; i < x * y; i++) {
-     board[i] = EMPTY;
-   }
-   return board;
-}
+void updateGameContext(GameContext *game, int status) {
+   PlayerRecord x, o;
+   int change;
 
-/* Check to see if game has been won. Returns 1 if it has,
-   and -1 if it hasn't.
-*/ 
-int checkWin(char *board, char playerSymbol) {
-   if(board[0] == playerSymbol && board[4] == playerSymbol
-     && board[8] == playerSymbol) { // Checks specific board location
-      return 1;
-   }
-   if(board[2] == playerSymbol && board[4] == playerSymbol
-     && board[6] == playerSymbol) { // Checks specific board location
-      return 1;
-   }
-   if(board[0] == playerSymbol && board[3] == playerSymbol
-     && board[6] == playerSymbol) { // Checks specific board location
-      return 1;
-   }
-   if(board[2] == playerSymbol && board[5] == playerSymbol
-     && board[8] == playerSymbol) { // Checks specific board location
-      return 1; 
+   copyPlayer(game->scoreboard, game->playerXId, &x);
+   copyPlayer(game->scoreboard, game->playerOId, &o);
+   // If player 1 or X has won
+   if(status == 1) {
+      change = ratingChange(x.rating, o.rating, 2);
+      addResult(game->scoreboard, game->playerXId, 1, 0, 0, change);
+      addResult(game->scoreboard, game->playerOId, 0, 1, 0, -change);
    }
-   if(board[1] == playerSymbol && board[4] == playerSymbol
-     && board[7] == playerSymbol) { // Checks specific board location
-      return 1;
+   // If player 2 or O has won
+   else if(status == 2) {
+      change = ratingChange(o.rating, x.rating, 2);
+      addResult(game->scoreboard, game->playerOId, 1, 0, 0, change);
+      addResult(game->scoreboard, game->playerXId, 0, 1, 0, -change);
    }
-   int row = 0;
-   while(row < 7) {   // Checks row of board for win
-      if(board[row] == playerSymbol && board[row+1] == playerSymbol
-        && board[row+2] == playerSymbol) {
-         return 1;
-      }
-     row = row + 3; // Add 3 to current row to get next row
+   // If game has ended in a draw
+   else if(status == 3) {
+      change = ratingChange(x.rating, o.rating, 1);
+      addResult(game->scoreboard, game->playerXId, 0, 0, 1, change);
+      addResult(game->scoreboard, game->playerOId, 0, 0, 1, -change);
    }
-   return -1;
+   logResult(game->storage, game->playerXId);
+   logResult(game->storage, game->playerOId);
+   rankPlayer(game->leaders, game->playerXId);
+   rankPlayer(game->leaders, game->playerOId);
+   recordGame(game, status);
 }
 
-/* Function checks board for a draw
+/* Function appends the game's players, start, moves, and
+   result to the journal.
 */
-int checkDraw(char *board) {
-   int status = 2; // Status is a draw when 2
-   
-   // Iterates through each board location
-   for(int i = 0; i < 10; i++) {
-   
-      // If a empty location on board exists, no draw
-      if(board[i] == EMPTY) {
-         status = -1;  // Game is not over
-         return status;
-      }
-   }
-   return status;
+void recordGame(GameContext *game, int result) {
+   JournalGame entry;
+
+   memset(&entry, 0, sizeof(JournalGame));
+   entry.playerX = game->playerXId;
+   entry.playerO = game->playerOId;
+   entry.started = game->started;
+   entry.plies = game->board.moves;
+   entry.size = game->board.size;
+   entry.run = game->board.run;
+   entry.result = result;
+   entry.computer = game->computer;
+   journalGame(game->journal, &entry, game->cells);
 }
 
-/* Print the tic-tac-toe board.
+/* Function adds indication that game is continuing and the
+   updated board to the output of both players.
 */
-void printBoard(char *board) {
-   char val;
-   for(int i = 0; i < 3; i++) {
-      for(int j = 0; j < 3; j++) {
-         val = get(board, i, j);
-         printf("%c ", val);
-      }
-      printf("\n");
+void sendUpdate(GameContext *game, int gameStat) {
+   putInt(&game->toX, gameStat);
+   putBoard(&game->toX, &game->board);
+   putInt(&game->toO, gameStat);
+   putBoard(&game->toO, &game->board);
+}
+
+/* Function adds results of game to the output of winning and
+   losing player or both players' draw result depending on gameStat.
+*/
+void sendResult(Message *winner, Message *loser, int gameStat, Board *board) {
+   int lose = 0; // Sent to player that loses the game
+   
+   // If gameStat is 1, the game has been won by a player
+   if(gameStat == 1) {
+      putInt(winner, gameStat);
+      putBoard(winner, board);
+      putInt(loser, lose);
+      putBoard(loser, board);
+   }
+   // If gameStat is 2, the game has ended in a draw
+   else if(gameStat == 2) {
+      putInt(winner, gameStat);
+      putBoard(winner, board);
+      putInt(loser, gameStat);
+      putBoard(loser, board);
    }
 }
@@ -0,0 +1,669 @@
+/*
+This module keeps the scoreboard on disk. A log record
+holds a player's whole record as it was when appended,
+not the change, so replaying a record any number of times
+leaves the same scoreboard, and the last record of each
+player is their latest. A checkpoint renames the log
+aside before copying the scoreboard, so every record in
+the renamed log is in the snapshot once it is written and
+the renamed log can be removed. If the snapshot cannot be
+written the renamed log is kept, and the logs of later
+checkpoints are added to its end until one succeeds. At
+start up the snapshot is loaded and both logs are
+replayed over it, the renamed one first. A snapshot
+in an older layout, or from before snapshots had a header,
+is rewritten beside it and renamed over it once whole.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "storage.h"
+
+#define PLAYER_RECORD_SIZE (1 + sizeof(int) + 42)
+#define RESULT_RECORD_SIZE (1 + 4 * sizeof(int))
+#define RATED_RECORD_SIZE (1 + 5 * sizeof(int))
+#define UNRATED_SIZE offsetof(PlayerRecord, rating) // Record before ratings were kept
+
+void *writerThread(void *args);
+void appendRecord(Storage *storage, char *record, int size);
+void checkpoint(Storage *storage);
+void markDirty(Storage *storage, int loc);
+void takeDirty(Storage *storage);
+void keepDirty(Storage *storage);
+int writeSnapshot(Storage *storage);
+int appendLog(char *from, char *to);
+int loadSnapshot(Storage *storage);
+int growSnapshot(Storage *storage, int count);
+PlayerRecord *snapshotRecord(Storage *storage, int index);
+int syncSnapshot(Storage *storage, long from, long size);
+int replayLog(Storage *storage, char *path);
+int loadScoreboard(Registry *scoreboard, char *records, int stride,
+                   int count, int headerless);
+int writeAll(int fd, char *data, int size);
+long clockMs(void);
+long clockUs(void);
+
+/* Function loads the scoreboard from the snapshot and logs
+   left by the last server session, checkpoints it, and
+   starts the thread which writes the log.
+   Returns NULL if the files could not be opened.
+*/
+Storage *openStorage(Registry *scoreboard, int syncMs) {
+   Storage *storage = (Storage*)calloc(1, sizeof(Storage));
+   pthread_condattr_t attr;
+   int replayed, rewrite, loc;
+   long started = clockUs();
+
+   storage->scoreboard = scoreboard;
+   storage->syncMs = syncMs;
+   pthread_mutex_init(&storage->lock, NULL);
+   // Snapshot could not be opened or is newer than this server
+   if((rewrite = loadSnapshot(storage)) == -1) { return NULL; }
+   replayed = replayLog(storage, OLD_LOG_FILE);
+   replayed += replayLog(storage, LOG_FILE);
+   storage->players = countPlayers(scoreboard);
+   printf("Loaded %d players, replayed %d log records in %.1f ms\n",
+          storage->players, replayed, (clockUs() - started) / 1000.0);
+
+   // New snapshot holds none of the records yet
+   if(rewrite) {
+      for(loc = 0; loc < storage->players; loc++) {
+         markDirty(storage, loc);
+      }
+   }
+   // Logs are only removed once everything in them is in the snapshot
+   takeDirty(storage);
+   if(writeSnapshot(storage) == -1) {
+      // Old snapshot is still the only one, keep every file as it was
+      if(rewrite) {
+         printf("Scoreboard could not be rewritten\n");
+         return NULL;
+      }
+      // Keep the current log with the renamed one for the next start
+      if(appendLog(LOG_FILE, OLD_LOG_FILE) == -1) { return NULL; }
+      keepDirty(storage);
+      storage->keptLog = 1;
+      printf("Snapshot could not be written, logs kept\n");
+   }
+   else {
+      // Snapshot was loaded from another layout and is now whole in this one
+      if(rewrite) {
+         rename(SNAPSHOT_TEMP, SNAPSHOT_FILE);
+         printf("Scoreboard rewritten in version %d\n", SNAPSHOT_VERSION);
+      }
+      unlink(OLD_LOG_FILE);
+   }
+   storage->logfd = open(LOG_FILE, O_CREAT|O_WRONLY|O_TRUNC|O_APPEND,
+                         S_IRUSR|S_IWUSR);
+   // Log could not be opened
+   if(storage->logfd == -1) { return NULL; }
+
+   pthread_condattr_init(&attr);
+   pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+   pthread_cond_init(&storage->added, &attr);
+   pthread_create(&storage->thread, NULL, writerThread, storage);
+   return storage;
+}
+
+/* Function appends a new player's name and password to the
+   log. The caller holds the registry's lock, so players are
+   logged in the order they were placed.
+*/
+void logPlayer(Storage *storage, int loc) {
+   PlayerEntry *entry = getPlayer(storage->scoreboard, loc);
+   char record[PLAYER_RECORD_SIZE];
+
+   record[0] = LOG_PLAYER;
+   memcpy(record + 1, &loc, sizeof(int));
+   memcpy(record + 1 + sizeof(int), entry->name, 21);
+   memcpy(record + 1 + sizeof(int) + 21, entry->password, 21);
+   pthread_mutex_lock(&storage->lock);
+   markDirty(storage, loc);
+   storage->players = loc + 1;
+   appendRecord(storage, record, PLAYER_RECORD_SIZE);
+   pthread_mutex_unlock(&storage->lock);
+}
+
+/* Function appends a player's wins, losses, ties, and
+   rating to the log. They are copied under the log's lock, so a later
+   record of the same player never holds fewer games.
+*/
+void logResult(Storage *storage, int loc) {
+   PlayerRecord copy;
+   char record[RATED_RECORD_SIZE];
+
+   record[0] = LOG_RATED;
+   memcpy(record + 1, &loc, sizeof(int));
+   pthread_mutex_lock(&storage->lock);
+   copyPlayer(storage->scoreboard, loc, &copy);
+   memcpy(record + 1 + sizeof(int), &copy.wins, sizeof(int));
+   memcpy(record + 1 + 2 * sizeof(int), &copy.losses, sizeof(int));
+   memcpy(record + 1 + 3 * sizeof(int), &copy.ties, sizeof(int));
+   memcpy(record + 1 + 4 * sizeof(int), &copy.rating, sizeof(int));
+   markDirty(storage, loc);
+   appendRecord(storage, record, RATED_RECORD_SIZE);
+   pthread_mutex_unlock(&storage->lock);
+}
+
+/* Function adds a record to the pending records and wakes
+   the writer. The caller holds the log's lock.
+*/
+void appendRecord(Storage *storage, char *record, int size) {
+   // Grow the pending records while the writer is behind
+   if(storage->pendingSize + size > storage->pendingCap) {
+      storage->pendingCap = storage->pendingCap == 0 ? 4096
+                            : storage->pendingCap * 2;
+      storage->pending = (char*)realloc(storage->pending, storage->pendingCap);
+   }
+   memcpy(storage->pending + storage->pendingSize, record, size);
+   storage->pendingSize += size;
+   pthread_cond_signal(&storage->added);
+}
+
+/* Thread function which writes every record appended while
+   it was busy in one group, syncs the log at most syncMs
+   after a group was written, and checkpoints once the log
+   is large or old enough. It sleeps while there is nothing
+   to do.
+*/
+void *writerThread(void *args) {
+   Storage *storage = (Storage*) args;
+   char *records = NULL, *spare;
+   int size, cap = 0, spareCap;
+   long now, due, syncAt = -1, checkpointAt = -1;
+   struct timespec until;
+
+   while(1) {
+      pthread_mutex_lock(&storage->lock);
+      // Wait for records, or for a sync or checkpoint to be due
+      while(storage->pendingSize == 0) {
+         due = syncAt;
+         if(checkpointAt >= 0 && (due < 0 || checkpointAt < due)) {
+            due = checkpointAt;
+         }
+         // Nothing is waiting on the disk
+         if(due < 0) {
+            pthread_cond_wait(&storage->added, &storage->lock);
+            continue;
+         }
+         if(clockMs() >= due) { break; }
+         until.tv_sec = due / 1000;
+         until.tv_nsec = (due % 1000) * 1000000L;
+         pthread_cond_timedwait(&storage->added, &storage->lock, &until);
+      }
+      // Take the pending records and leave the spare buffer for appends
+      spare = records;
+      records = storage->pending;
+      size = storage->pendingSize;
+      storage->pending = spare;
+      storage->pendingSize = 0;
+      spareCap = cap;
+      cap = storage->pendingCap;
+      storage->pendingCap = spareCap;
+      pthread_mutex_unlock(&storage->lock);
+
+      now = clockMs();
+      if(size > 0) {
+         writeAll(storage->logfd, records, size);
+         // First group in the log starts the checkpoint clock
+         if(storage->logSize == 0) {
+            checkpointAt = now + CHECKPOINT_SECONDS * 1000L;
+         }
+         storage->logSize += size;
+         if(syncAt < 0) { syncAt = now + storage->syncMs; }
+      }
+      // Groups written since the last sync have waited long enough
+      if(syncAt >= 0 && now >= syncAt) {
+         fdatasync(storage->logfd);
+         syncAt = -1;
+      }
+      if(storage->logSize >= CHECKPOINT_BYTES
+         || (checkpointAt >= 0 && now >= checkpointAt)) {
+         checkpoint(storage);
+         syncAt = -1;
+         checkpointAt = -1;
+      }
+   }
+}
+
+/* Function renames the log aside and starts a new one, then
+   writes the records changed since the last checkpoint to
+   the snapshot and removes the renamed log once the
+   snapshot is on disk. Records still pending go to the new
+   log, which is safe since every record holds a whole
+   record. A renamed log kept by a failed checkpoint is
+   added to rather than replaced.
+*/
+void checkpoint(Storage *storage) {
+   printf("Checkpointing\n");
+   fdatasync(storage->logfd);
+   if(storage->keptLog) {
+      // Log could not be added to the kept one, keep writing it
+      if(appendLog(LOG_FILE, OLD_LOG_FILE) == -1) {
+         printf("Log could not be checkpointed\n");
+         return;
+      }
+   }
+   else { rename(LOG_FILE, OLD_LOG_FILE); }
+   close(storage->logfd);
+   storage->logfd = open(LOG_FILE, O_CREAT|O_WRONLY|O_TRUNC|O_APPEND,
+                         S_IRUSR|S_IWUSR);
+   storage->logSize = 0;
+   // Every record in the renamed log was marked before this
+   takeDirty(storage);
+   // Snapshot is not on disk, the renamed log is all that holds the records
+   if(writeSnapshot(storage) == -1) {
+      keepDirty(storage);
+      storage->keptLog = 1;
+      printf("Snapshot could not be written, log kept\n");
+      return;
+   }
+   unlink(OLD_LOG_FILE);
+   storage->keptLog = 0;
+}
+
+/* Function adds a log to the end of another and syncs it,
+   taking back anything it added if the disk refused part.
+   Returns 0, or -1 if the log could not be added.
+*/
+int appendLog(char *from, char *to) {
+   char chunk[65536];
+   int in, out, got, result = 0;
+   off_t size;
+
+   in = open(from, O_RDONLY);
+   // Log was never written, nothing to add
+   if(in == -1) { return 0; }
+   out = open(to, O_CREAT|O_WRONLY|O_APPEND, S_IRUSR|S_IWUSR);
+   if(out == -1) {
+      close(in);
+      return -1;
+   }
+   size = lseek(out, 0, SEEK_END);
+   while((got = read(in, chunk, sizeof(chunk))) > 0) {
+      if(writeAll(out, chunk, got) == -1) {
+         result = -1;
+         break;
+      }
+   }
+   if(got < 0 || fdatasync(out) == -1) { result = -1; }
+   // Part of a record at the end would stop the replay before later ones
+   if(result == -1) { ftruncate(out, size); }
+   close(in);
+   close(out);
+   return result;
+}
+
+/* Function marks a player's record as changed since the
+   last checkpoint. The caller holds the log's lock.
+*/
+void markDirty(Storage *storage, int loc) {
+   int words = storage->dirtyWords;
+
+   // Grow the bitmap to cover new players
+   if(loc / DIRTY_BITS >= words) {
+      while(loc / DIRTY_BITS >= words) { words = words == 0 ? 64 : words * 2; }
+      storage->dirty = (unsigned long*)realloc(storage->dirty,
+                                               words * sizeof(unsigned long));
+      memset(storage->dirty + storage->dirtyWords, 0,
+             (words - storage->dirtyWords) * sizeof(unsigned long));
+      storage->dirtyWords = words;
+   }
+   storage->dirty[loc / DIRTY_BITS] |= 1UL << (loc % DIRTY_BITS);
+}
+
+/* Function takes the records marked since the last
+   checkpoint for the snapshot to write, leaving a cleared
+   bitmap to mark the next ones in. The players logged are
+   counted under the same lock, so every player counted is
+   marked in the bitmap taken or was in the snapshot before.
+*/
+void takeDirty(Storage *storage) {
+   unsigned long *spare = storage->flushing;
+   int spareWords = storage->flushingWords;
+
+   pthread_mutex_lock(&storage->lock);
+   storage->flushing = storage->dirty;
+   storage->flushingWords = storage->dirtyWords;
+   storage->flushingCount = storage->players;
+   storage->dirty = spare;
+   storage->dirtyWords = spareWords;
+   pthread_mutex_unlock(&storage->lock);
+}
+
+/* Function marks the records taken by takeDirty again after
+   the snapshot could not be written, so the next checkpoint
+   writes them.
+*/
+void keepDirty(Storage *storage) {
+   unsigned long bits;
+   int word, bit;
+
+   pthread_mutex_lock(&storage->lock);
+   for(word = 0; word < storage->flushingWords; word++) {
+      bits = storage->flushing[word];
+      storage->flushing[word] = 0;
+      for(bit = 0; bits != 0; bit++, bits >>= 1) {
+         if(bits & 1) { markDirty(storage, word * DIRTY_BITS + bit); }
+      }
+   }
+   pthread_mutex_unlock(&storage->lock);
+}
+
+/* Function copies the records taken by takeDirty into the
+   snapshot, syncing each run of records close enough to
+   share pages with one msync, and clears their marks once
+   all are synced. The records are synced before the count
+   in the header, so the header never counts a record not
+   yet on disk.
+   Returns 0, or -1 if the snapshot could not be grown or
+   synced, leaving the marks for keepDirty.
+*/
+int writeSnapshot(Storage *storage) {
+   SnapshotHeader *header;
+   int count = storage->flushingCount;
+   long page = sysconf(_SC_PAGESIZE);
+   long from = -1, to = 0, at;
+   unsigned long bits;
+   int word, bit, loc;
+
+   if(growSnapshot(storage, count) == -1) { return -1; }
+   for(word = 0; word < storage->flushingWords; word++) {
+      bits = storage->flushing[word];
+      for(bit = 0; bits != 0; bit++, bits >>= 1) {
+         if((bits & 1) == 0) { continue; }
+         loc = word * DIRTY_BITS + bit;
+         copyPlayer(storage->scoreboard, loc, snapshotRecord(storage, loc));
+         at = SNAPSHOT_HEADER + (long) loc * sizeof(PlayerRecord);
+         // Record shares no page with the run, sync the run alone
+         if(from >= 0 && at > to + page) {
+            if(syncSnapshot(storage, from, to - from) == -1) { return -1; }
+            from = -1;
+         }
+         if(from < 0) { from = at; }
+         to = at + sizeof(PlayerRecord);
+      }
+   }
+   if(from >= 0 && syncSnapshot(storage, from, to - from) == -1) {
+      return -1;
+   }
+   header = (SnapshotHeader*) storage->map;
+   // Players were added since the last checkpoint
+   if(header->count != count) {
+      header->count = count;
+      if(syncSnapshot(storage, 0, sizeof(SnapshotHeader)) == -1) { return -1; }
+   }
+   for(word = 0; word < storage->flushingWords; word++) {
+      storage->flushing[word] = 0;
+   }
+   return 0;
+}
+
+/* Function maps the snapshot and loads the players in it.
+   A snapshot in this layout is kept and updated in place.
+   Any other is loaded and a new one is started beside it.
+   Returns 0, 1 if a new one was started beside it, or -1
+   if the snapshot could not be opened, was written by a
+   newer server, or is damaged.
+*/
+int loadSnapshot(Storage *storage) {
+   SnapshotHeader *header, fresh;
+   struct stat info;
+   char *map;
+   long size;
+
+   storage->fd = open(SNAPSHOT_FILE, O_CREAT|O_RDWR, S_IRUSR|S_IWUSR);
+   // Snapshot could not be opened
+   if(storage->fd == -1 || fstat(storage->fd, &info) == -1) { return -1; }
+   size = info.st_size;
+   // Snapshot is new, start it in this layout
+   if(size == 0) { map = NULL; }
+   else {
+      map = (char*)mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED,
+                        storage->fd, 0);
+      if(map == MAP_FAILED) { return -1; }
+   }
+   header = (SnapshotHeader*) map;
+
+   // Snapshot starts with a header
+   if(size >= (long) sizeof(SnapshotHeader)
+      && memcmp(header->magic, SNAPSHOT_MAGIC, 8) == 0) {
+      // Header is from a newer server or does not fit the file
+      if(header->version > SNAPSHOT_VERSION
+         || header->stride < (int) (header->version == 1 ? UNRATED_SIZE
+                                    : sizeof(PlayerRecord))
+         || header->headerSize < (int) sizeof(SnapshotHeader)
+         || header->headerSize + (long) header->count * header->stride > size) {
+         printf("Snapshot version %d cannot be read\n", header->version);
+         munmap(map, size);
+         return -1;
+      }
+      madvise(map, size, MADV_SEQUENTIAL);
+      if(loadScoreboard(storage->scoreboard, map + header->headerSize,
+                        header->stride, header->count, 0) == -1) {
+         munmap(map, size);
+         return -1;
+      }
+      // Snapshot is in this layout, keep using it
+      if(header->version == SNAPSHOT_VERSION
+         && header->headerSize == SNAPSHOT_HEADER
+         && header->stride == (int) sizeof(PlayerRecord)) {
+         storage->map = map;
+         storage->mapSize = size;
+         return 0;
+      }
+   }
+   // Snapshot is records alone, from before the header
+   else if(size > 0 && loadScoreboard(storage->scoreboard, map, UNRATED_SIZE,
+                                      size / UNRATED_SIZE, 1) == -1) {
+      munmap(map, size);
+      return -1;
+   }
+
+   // Start a snapshot in this layout, beside any old one
+   if(map != NULL) {
+      munmap(map, size);
+      close(storage->fd);
+      storage->fd = open(SNAPSHOT_TEMP, O_CREAT|O_RDWR|O_TRUNC,
+                         S_IRUSR|S_IWUSR);
+      if(storage->fd == -1) { return -1; }
+   }
+   if(growSnapshot(storage, 0) == -1) { return -1; }
+   memset(&fresh, 0, sizeof(SnapshotHeader));
+   memcpy(fresh.magic, SNAPSHOT_MAGIC, 8);
+   fresh.version = SNAPSHOT_VERSION;
+   fresh.headerSize = SNAPSHOT_HEADER;
+   fresh.stride = sizeof(PlayerRecord);
+   memcpy(storage->map, &fresh, sizeof(SnapshotHeader));
+   return map != NULL;
+}
+
+/* Function makes room in the snapshot for count records,
+   doubling the file and mapping it again until they fit.
+   Returns 0, or -1 if the file could not be grown.
+*/
+int growSnapshot(Storage *storage, int count) {
+   long need = SNAPSHOT_HEADER + (long) count * sizeof(PlayerRecord);
+   long size = storage->mapSize == 0 ? SNAPSHOT_MIN : storage->mapSize;
+   char *map;
+
+   // Records already fit
+   if(need <= storage->mapSize) { return 0; }
+   while(size < need) { size *= 2; }
+   if(ftruncate(storage->fd, size) == -1) { return -1; }
+   map = (char*)mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED,
+                     storage->fd, 0);
+   if(map == MAP_FAILED) { return -1; }
+   if(storage->map != NULL) { munmap(storage->map, storage->mapSize); }
+   storage->map = map;
+   storage->mapSize = size;
+   return 0;
+}
+
+/* Function gets the place of a record in the snapshot.
+*/
+PlayerRecord *snapshotRecord(Storage *storage, int index) {
+   return (PlayerRecord*)(storage->map + SNAPSHOT_HEADER
+                          + (long) index * sizeof(PlayerRecord));
+}
+
+/* Function syncs a range of the snapshot to disk, from the
+   start of the page it begins in.
+   Returns 0, or -1 if the range could not be written.
+*/
+int syncSnapshot(Storage *storage, long from, long size) {
+   long page = sysconf(_SC_PAGESIZE);
+   long start = from - from % page;
+
+   return msync(storage->map + start, from + size - start, MS_SYNC);
+}
+
+/* Function replays a log over the scoreboard, stopping at
+   the first record which is cut short or out of place, and
+   marks the records it changed. Anything after that is cut
+   off the log, so a log added to its end is replayed too.
+   Returns the number of records replayed.
+*/
+int replayLog(Storage *storage, char *path) {
+   Registry *scoreboard = storage->scoreboard;
+   PlayerRecord record;
+   struct stat info;
+   char *data;
+   long size, at = 0;
+   int fd, done = 0, loc;
+
+   fd = open(path, O_RDONLY);
+   // Log was never written or was already removed
+   if(fd == -1) { return 0; }
+   fstat(fd, &info);
+   size = info.st_size;
+   data = size == 0 ? MAP_FAILED
+          : (char*)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   // Log is empty or could not be mapped
+   if(data == MAP_FAILED) { return 0; }
+   madvise(data, size, MADV_SEQUENTIAL);
+
+   // Replay while a whole record is left
+   while(at + 1 + (long) sizeof(int) <= size) {
+      memcpy(&loc, data + at + 1, sizeof(int));
+      if(data[at] == LOG_PLAYER && at + (long) PLAYER_RECORD_SIZE <= size
+         && loc <= countPlayers(scoreboard)) {
+         // Player is new since the snapshot
+         if(loc == countPlayers(scoreboard)) {
+            memset(&record, 0, sizeof(PlayerRecord));
+            memcpy(record.name, data + at + 1 + sizeof(int), 21);
+            memcpy(record.password, data + at + 1 + sizeof(int) + 21, 21);
+            record.rating = START_RATING;
+            addPlayer(scoreboard, &record);
+            markDirty(storage, loc);
+         }
+         at += PLAYER_RECORD_SIZE;
+      }
+      else if(data[at] == LOG_RESULT && at + (long) RESULT_RECORD_SIZE <= size
+              && loc >= 0 && loc < countPlayers(scoreboard)) {
+         // Log is from before ratings, keep the rating loaded
+         copyPlayer(scoreboard, loc, &record);
+         memcpy(&record.wins, data + at + 1 + sizeof(int), sizeof(int));
+         memcpy(&record.losses, data + at + 1 + 2 * sizeof(int), sizeof(int));
+         memcpy(&record.ties, data + at + 1 + 3 * sizeof(int), sizeof(int));
+         setResults(scoreboard, loc, &record);
+         markDirty(storage, loc);
+         at += RESULT_RECORD_SIZE;
+      }
+      else if(data[at] == LOG_RATED && at + (long) RATED_RECORD_SIZE <= size
+              && loc >= 0 && loc < countPlayers(scoreboard)) {
+         memcpy(&record.wins, data + at + 1 + sizeof(int), sizeof(int));
+         memcpy(&record.losses, data + at + 1 + 2 * sizeof(int), sizeof(int));
+         memcpy(&record.ties, data + at + 1 + 3 * sizeof(int), sizeof(int));
+         memcpy(&record.rating, data + at + 1 + 4 * sizeof(int), sizeof(int));
+         setResults(scoreboard, loc, &record);
+         markDirty(storage, loc);
+         at += RATED_RECORD_SIZE;
+      }
+      // Record was torn by a crash
+      else { break; }
+      done++;
+   }
+   munmap(data, size);
+   if(at < size) { truncate(path, at); }
+   return done;
+}
+
+/* Function loades scoreboard from previous
+   server session, from count records stride bytes apart,
+   straight out of the mapped snapshot. Every record is
+   checked before it is placed. A headerless snapshot may
+   have slots never used by a player, which are skipped.
+   Records written before ratings were kept start with a
+   new player's rating.
+   Returns the number of players loaded, or -1 if a record
+   is damaged.
+*/
+int loadScoreboard(Registry *scoreboard, char *records, int stride,
+                   int count, int headerless) {
+   PlayerRecord copy, *record = &copy;
+   int i, loaded = 0;
+
+   reservePlayers(scoreboard, count);
+   copy.rating = START_RATING;
+   for(i = 0; i < count; i++) {
+      memcpy(&copy, records + (long) i * stride,
+             stride < (int) sizeof(PlayerRecord) ? (size_t) stride
+                                                 : sizeof(PlayerRecord));
+      // Slot was never used by a player
+      if(headerless && record->name[0] == '\0') { continue; }
+      // Record is cut off, impossible, or a second copy of a player
+      if(record->name[0] == '\0' || memchr(record->name, '\0', 21) == NULL
+         || memchr(record->password, '\0', 21) == NULL
+         || record->wins < 0 || record->losses < 0 || record->ties < 0
+         || findPlayer(scoreboard, record->name) >= 0) {
+         printf("Snapshot record %d is damaged\n", i);
+         return -1;
+      }
+      addPlayer(scoreboard, record);
+      loaded++;
+   }
+   return loaded;
+}
+
+/* Function writes all of data, however many writes it takes.
+   Returns 0, or -1 if the disk refused it.
+*/
+int writeAll(int fd, char *data, int size) {
+   int sent;
+
+   while(size > 0) {
+      sent = write(fd, data, size);
+      // Write unsuccessful
+      if(sent <= 0) { return -1; }
+      data += sent;
+      size -= sent;
+   }
+   return 0;
+}
+
+/* Function gets the time on the monotonic clock in
+   milliseconds.
+*/
+long clockMs(void) {
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return now.tv_sec * 1000L + now.tv_nsec / 1000000;
+}
+
+/* Function gets the time on the monotonic clock in
+   microseconds.
+*/
+long clockUs(void) {
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return now.tv_sec * 1000000L + now.tv_nsec / 1000;
+}
@@ -0,0 +1,67 @@
+/*
+This module keeps the scoreboard on disk. Every new player
+and every changed record is appended to a log as it
+happens, and the log is written by its own thread in
+groups, so a game never waits on the disk. At checkpoints
+the records changed since the last one are copied in
+place into the snapshot, which is mapped into memory,
+after which the log is started over.
+*/
+
+#ifndef STORAGE_H
+#define STORAGE_H
+
+#include <pthread.h>
+#include "registry.h"
+
+#define SNAPSHOT_FILE "scoreboard.bin"
+#define SNAPSHOT_TEMP "scoreboard.bin.new" // Snapshot being rewritten in a new format
+#define SNAPSHOT_MAGIC "\x89TTT\r\n\x1a\n" // Never the start of a player's name
+#define SNAPSHOT_VERSION 2   // Version 1 records had no rating
+#define SNAPSHOT_HEADER 64   // Bytes before the first record
+#define SNAPSHOT_MIN 4096    // Smallest snapshot file, grown by doubling
+#define LOG_FILE "scoreboard.log"
+#define OLD_LOG_FILE "scoreboard.log.old" // Log being checkpointed
+#define LOG_PLAYER 'P'       // Location, name, then password
+#define LOG_RESULT 'R'       // Location, wins, losses, then ties, from before ratings
+#define LOG_RATED 'E'        // Location, wins, losses, ties, then rating
+#define CHECKPOINT_BYTES (4 << 20) // Log size that forces a checkpoint
+#define CHECKPOINT_SECONDS 300 // Longest a log is kept before a checkpoint
+#define DIRTY_BITS (8 * (int) sizeof(unsigned long)) // Records marked in a word of a bitmap
+
+typedef struct SNAPSHOTHEADER {
+   char magic[8];
+   int version;         // Raised whenever the layout changes
+   int headerSize;      // Bytes before the first record
+   int stride;          // Bytes from one record to the next
+   int count;           // Records in the snapshot
+}  SnapshotHeader;
+
+typedef struct STORAGE {
+   Registry *scoreboard;
+   int fd;              // Snapshot written at each checkpoint
+   char *map;           // Snapshot mapped into memory
+   long mapSize;
+   int logfd;           // Log appended to since the last checkpoint
+   long logSize;
+   int syncMs;          // Longest written records wait for fsync, 0 syncs every group
+   pthread_t thread;
+   pthread_mutex_t lock; // Guards the pending records
+   pthread_cond_t added; // Signaled when records are appended
+   char *pending;       // Records appended but not yet written
+   int pendingSize;
+   int pendingCap;
+   unsigned long *dirty; // Records changed since the last checkpoint
+   int dirtyWords;
+   int players;         // Players logged so far
+   unsigned long *flushing; // Records being written by a checkpoint
+   int flushingWords;
+   int flushingCount;   // Players the snapshot holds once they are written
+   int keptLog;         // 1 while the renamed log holds records not in the snapshot
+}  Storage;
+
+Storage *openStorage(Registry *scoreboard, int syncMs);
+void logPlayer(Storage *storage, int loc);
+void logResult(Storage *storage, int loc);
+
+#endif
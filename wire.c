@@ -0,0 +1,184 @@
+/*
+This module builds the messages sent between the server
+and players. Fields are appended to a message buffer in
+the order the receiver reads them, integers in network
+byte order, and the finished message is sent in one call
+instead of one call per field.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdatomic.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include "wire.h"
+
+atomic_long messagesSent;  // Messages built and sent so far
+atomic_long bytesSent;
+
+/* Function empties a message so fields can be added.
+*/
+void initMessage(Message *msg) {
+   msg->len = 0;
+}
+
+/* Function adds a single character to a message.
+*/
+void putChar(Message *msg, char value) {
+   putBytes(msg, &value, sizeof(char));
+}
+
+/* Function adds an integer to a message in network
+   byte order.
+*/
+void putInt(Message *msg, int value) {
+   int net = htonl(value);
+   putBytes(msg, &net, sizeof(int));
+}
+
+/* Function adds raw bytes to a message. Bytes which would
+   overflow the message are dropped.
+*/
+void putBytes(Message *msg, const void *bytes, int size) {
+   // Message is full, field cannot be added
+   if(msg->len + size > MESSAGE_SIZE) {
+      printf("Message too large\n");
+      return;
+   }
+   memcpy(msg->data + msg->len, bytes, size);
+   msg->len += size;
+}
+
+/* Function adds a string to a message as its size,
+   including the terminator, followed by its characters.
+*/
+void putString(Message *msg, const char *string) {
+   int size = strlen(string) + 1;
+   putInt(msg, size);
+   putBytes(msg, string, size);
+}
+
+/* Function reads an integer sent in network byte order.
+*/
+int getInt(const char *bytes) {
+   int net;
+   memcpy(&net, bytes, sizeof(int));
+   return ntohl(net);
+}
+
+/* Function sends a whole message with one call to send.
+   Returns 0 once every byte was sent and -1 on error.
+*/
+int sendMessage(int sockfd, Message *msg) {
+   int sent = 0, got;
+
+   // Blocking send only returns early if interrupted
+   while(sent < msg->len) {
+      got = send(sockfd, msg->data + sent, msg->len - sent, 0);
+      if(got <= 0) { return -1; }
+      sent += got;
+   }
+   countMessage(msg);
+   return 0;
+}
+
+/* Function counts a message towards the bytes per
+   message reported by printWireStats.
+*/
+void countMessage(Message *msg) {
+   atomic_fetch_add(&messagesSent, 1);
+   atomic_fetch_add(&bytesSent, msg->len);
+}
+
+/* Function prints how many messages were sent and their
+   average size.
+*/
+void printWireStats(void) {
+   long messages = atomic_load(&messagesSent);
+   long bytes = atomic_load(&bytesSent);
+
+   printf("Wire: %ld messages, %ld bytes, %.1f bytes per message\n\n",
+          messages, bytes, messages > 0 ? (double) bytes / messages : 0.0);
+}
+
+/* Function sets up an empty reader for a socket.
+*/
+void initReader(Reader *reader, int fd) {
+   reader->fd = fd;
+   reader->start = 0;
+   reader->end = 0;
+}
+
+/* Function receives as many bytes as fit in the reader with
+   one call. Returns the number of bytes received, 0 if none
+   were waiting, and -1 if the peer is gone.
+*/
+int fillReader(Reader *reader) {
+   int got;
+
+   // Move bytes not yet taken to the front to make room
+   if(reader->start > 0) {
+      memmove(reader->data, reader->data + reader->start,
+              reader->end - reader->start);
+      reader->end -= reader->start;
+      reader->start = 0;
+   }
+   // Reader is full, nothing can be received until bytes are taken
+   if(reader->end == READER_SIZE) { return 0; }
+   while(1) {
+      got = recv(reader->fd, reader->data + reader->end,
+                 READER_SIZE - reader->end, 0);
+      if(got > 0) {
+         reader->end += got;
+         return got;
+      }
+      // Peer closed the connection
+      if(got == 0) { return -1; }
+      // Nothing waiting on a non-blocking socket
+      if(errno == EAGAIN || errno == EWOULDBLOCK) { return 0; }
+      if(errno != EINTR) { return -1; }
+   }
+}
+
+/* Function takes a field of given size from the bytes already
+   received. Returns 1 if it was taken and 0 if it has not
+   fully arrived yet.
+*/
+int takeBytes(Reader *reader, void *bytes, int size) {
+   // Field has not fully arrived
+   if(reader->end - reader->start < size) { return 0; }
+   memcpy(bytes, reader->data + reader->start, size);
+   reader->start += size;
+   // Everything was taken, start over at the front
+   if(reader->start == reader->end) {
+      reader->start = 0;
+      reader->end = 0;
+   }
+   return 1;
+}
+
+/* Function waits until a field of given size has arrived and
+   takes it. Returns 0 on success and -1 if the peer is gone.
+*/
+int readBytes(Reader *reader, void *bytes, int size) {
+   // Field can never fit in the reader
+   if(size > READER_SIZE) { return -1; }
+   while(!takeBytes(reader, bytes, size)) {
+      if(fillReader(reader) == -1) { return -1; }
+   }
+   return 0;
+}
+
+/* Function waits for an integer sent in network byte order.
+   Returns 0 on success and -1 if the peer is gone.
+*/
+int readInt(Reader *reader, int *value) {
+   char bytes[sizeof(int)];
+
+   if(readBytes(reader, bytes, sizeof(int)) == -1) { return -1; }
+   *value = getInt(bytes);
+   return 0;
+}
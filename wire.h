@@ -0,0 +1,43 @@
+/*
+This module builds the messages sent between the server
+and players. Each logical message is written into one
+buffer with integers in network byte order, so it can be
+sent with a single system call. Received bytes are read
+in large chunks into a buffered reader and taken from it
+one field at a time.
+*/
+
+#ifndef WIRE_H
+#define WIRE_H
+
+#define MESSAGE_SIZE 512 // Largest message built in one buffer
+#define READER_SIZE 1024 // Bytes a reader buffers between fields
+
+typedef struct MESSAGE {
+   char data[MESSAGE_SIZE];
+   int len;
+}  Message;
+
+typedef struct READER {
+   int fd;
+   char data[READER_SIZE];
+   int start;           // First byte not yet taken
+   int end;             // One past the last byte received
+}  Reader;
+
+void initMessage(Message *msg);
+void putChar(Message *msg, char value);
+void putInt(Message *msg, int value);
+void putBytes(Message *msg, const void *bytes, int size);
+void putString(Message *msg, const char *string);
+int getInt(const char *bytes);
+int sendMessage(int sockfd, Message *msg);
+void countMessage(Message *msg);
+void printWireStats(void);
+void initReader(Reader *reader, int fd);
+int fillReader(Reader *reader);
+int takeBytes(Reader *reader, void *bytes, int size);
+int readBytes(Reader *reader, void *bytes, int size);
+int readInt(Reader *reader, int *value);
+
+#endif